@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+
+##===-----------------------------------------------------------------------------*- Python -*-===##
+##                          _
+##                         | |
+##                       __| | __ ___      ___ ___
+##                      / _` |/ _` \ \ /\ / / '_  |
+##                     | (_| | (_| |\ V  V /| | | |
+##                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+##
+##
+##  This file is distributed under the MIT License (MIT).
+##  See LICENSE.txt for details.
+##
+##===------------------------------------------------------------------------------------------===##
+
+"""Empirical block size tuning
+
+This program compiles a stencil once per candidate block size and times each version with a
+user-provided benchmark, e.g.
+
+    tune_block_size.py laplacian.sir --output laplacian.cpp -- ./run_benchmark.sh laplacian.cpp
+
+The generated code of each candidate is written to the output file before the benchmark command
+is run. The benchmark has to compile and run the code and print its run time on the last line of
+its output. The fastest block size is reported and can then be passed to the compiler with
+`block_size_i`, `block_size_j` and `block_size_k` (`-block-size-i`, ... in dawn-opt).
+
+The candidates should be the best ones of the cost model of the compiler
+(`-block-size-cost-model`) and its neighbours, timing every block size is rarely worth it.
+"""
+
+import argparse
+import subprocess
+import sys
+
+import dawn4py
+
+DEFAULT_CANDIDATES = "32x4x4,64x4x4,64x8x4,128x8x4,128x16x4,256x16x4"
+
+
+def parse_candidates(candidates: str):
+    return [tuple(int(size) for size in candidate.split("x")) for candidate in candidates.split(",")]
+
+
+def time_block_size(sir, block_size, args: argparse.Namespace):
+    code = dawn4py.compile(
+        sir,
+        backend=args.backend,
+        block_size_i=block_size[0],
+        block_size_j=block_size[1],
+        block_size_k=block_size[2],
+    )
+    with open(args.output, "w") as f:
+        f.write(code)
+
+    result = subprocess.run(args.benchmark, stdout=subprocess.PIPE, universal_newlines=True)
+    if result.returncode != 0:
+        print(f"benchmark failed for the block size {block_size}", file=sys.stderr)
+        return None
+    try:
+        return float(result.stdout.strip().splitlines()[-1])
+    except (IndexError, ValueError):
+        print(f"cannot parse the run time of the block size {block_size}", file=sys.stderr)
+        return None
+
+
+def main(args: argparse.Namespace):
+    with open(args.sir, "rb") as f:
+        sir = f.read()
+    if args.sir.endswith(".json"):
+        sir = sir.decode()
+
+    timings = {}
+    for block_size in parse_candidates(args.candidates):
+        time = time_block_size(sir, block_size, args)
+        if time is not None:
+            timings[block_size] = time
+            print(f"{'x'.join(str(size) for size in block_size)}: {time}")
+
+    if not timings:
+        sys.exit("no block size could be timed")
+    best = min(timings, key=timings.get)
+    print(f"best block size: {'x'.join(str(size) for size in best)}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Time a stencil for several block sizes and report the fastest one"
+    )
+    parser.add_argument("sir", help="SIR of the stencil (JSON if the file ends with .json)")
+    parser.add_argument("--output", required=True, help="file the generated code is written to")
+    parser.add_argument("--backend", default="c++-opt", help="backend generating the code")
+    parser.add_argument(
+        "--candidates",
+        default=DEFAULT_CANDIDATES,
+        help=f"comma separated block sizes IxJxK (default: {DEFAULT_CANDIDATES})",
+    )
+    parser.add_argument("benchmark", nargs=argparse.REMAINDER, help="benchmark command")
+    args = parser.parse_args()
+    if args.benchmark and args.benchmark[0] == "--":
+        args.benchmark = args.benchmark[1:]
+    if not args.benchmark:
+        parser.error("missing benchmark command")
+    main(args)
@@ -26,9 +26,10 @@ namespace codegen {
 namespace cxxnaiveico {
 
 ASTStencilBody::ASTStencilBody(const iir::StencilMetaInformation& metadata,
-                               StencilContext stencilContext)
+                               StencilContext stencilContext, bool staticNbhChains)
     : ASTCodeGenCXX(), metadata_(metadata), offsetPrinter_(",", "(", ")"),
-      currentFunction_(nullptr), nestingOfStencilFunArgLists_(0), stencilContext_(stencilContext) {}
+      currentFunction_(nullptr), nestingOfStencilFunArgLists_(0), stencilContext_(stencilContext),
+      staticNbhChains_(staticNbhChains) {}
 
 ASTStencilBody::~ASTStencilBody() {}
 
@@ -59,40 +60,62 @@ void ASTStencilBody::visit(const std::shared_ptr<iir::ReturnStmt>& stmt) {
   stmt->getExpr()->accept(*this);
   ss_ << ";\n";
 }
-void ASTStencilBody::visit(const std::shared_ptr<iir::ReductionOverNeighborExpr>& expr) {
-  auto getLocationTypeString = [](ast::LocationType type) {
-    switch(type) {
-    case ast::LocationType::Cells:
-      return "dawn::LocationType::Cells";
-    case ast::LocationType::Edges:
-      return "dawn::LocationType::Edges";
-    case ast::LocationType::Vertices:
-      return "dawn::LocationType::Vertices";
-    default:
-      dawn_unreachable("unknown location type");
-      return "";
-    }
-  };
+namespace {
+std::string getLocationTypeString(ast::LocationType type) {
+  switch(type) {
+  case ast::LocationType::Cells:
+    return "dawn::LocationType::Cells";
+  case ast::LocationType::Edges:
+    return "dawn::LocationType::Edges";
+  case ast::LocationType::Vertices:
+    return "dawn::LocationType::Vertices";
+  default:
+    dawn_unreachable("unknown location type");
+    return "";
+  }
+}
 
+std::string getChainString(const std::vector<ast::LocationType>& chain) {
+  return RangeToString(", ", "", "")(chain, getLocationTypeString);
+}
+} // namespace
+
+std::string
+ASTStencilBody::getNeighborListLookup(const std::vector<ast::LocationType>& chain) const {
+  const std::string chainStr = getChainString(chain);
+  if(staticNbhChains_)
+    return "getNeighborList<" + chainStr + ">(LibTag{}, m_mesh, loc)";
+  return "getNeighborList(LibTag{}, m_mesh, loc, std::vector<dawn::LocationType>{" + chainStr +
+         "})";
+}
+
+void ASTStencilBody::visit(const std::shared_ptr<iir::ReductionOverNeighborExpr>& expr) {
   bool hasWeights = expr->getWeights().has_value();
 
   std::string sigArg =
       (parentIsReduction_)
           ? "red_loc"
           : "loc"; // does stage or parent reduceOverNeighborExpr determine argname?
-  ss_ << std::string(indent_, ' ') << "reduce(LibTag{}, m_mesh," << sigArg << ", ";
-  expr->getInit()->accept(*this);
-
-  ss_ << ", std::vector<dawn::LocationType>{";
-  bool first = true;
-  for(const auto& loc : expr->getNbhChain()) {
-    if(!first) {
-      ss_ << ", ";
+  std::string chain = getChainString(expr->getNbhChain());
+
+  auto nbhListIt = parentIsReduction_ ? nbhLists_.end() : nbhLists_.find(expr->getNbhChain());
+  if(nbhListIt != nbhLists_.end()) {
+    // the neighbors were looked up before the vertical loop
+    ss_ << std::string(indent_, ' ') << "reduce(LibTag{}, " << nbhListIt->second << ", ";
+    expr->getInit()->accept(*this);
+  } else {
+    // static chains are template arguments of the call, otherwise the chain is passed as a vector
+    ss_ << std::string(indent_, ' ') << "reduce";
+    if(staticNbhChains_) {
+      ss_ << "<" << chain << ">";
+    }
+    ss_ << "(LibTag{}, m_mesh," << sigArg << ", ";
+    expr->getInit()->accept(*this);
+
+    if(!staticNbhChains_) {
+      ss_ << ", std::vector<dawn::LocationType>{" << chain << "}";
     }
-    ss_ << getLocationTypeString(loc);
-    first = false;
   }
-  ss_ << "}";
   if(hasWeights) {
     ss_ << ", [&](auto& lhs, auto red_loc, auto const& weight) {\n";
     ss_ << "lhs " << expr->getOp() << "= ";
@@ -119,7 +142,11 @@ void ASTStencilBody::visit(const std::shared_ptr<iir::ReductionOverNeighborExpr>
     auto weights = expr->getWeights().value();
     bool first = true;
 
-    ss_ << ", std::vector<::dawn::float_type>({";
+    if(staticNbhChains_) {
+      ss_ << ", std::array<::dawn::float_type, " << weights.size() << ">({";
+    } else {
+      ss_ << ", std::vector<::dawn::float_type>({";
+    }
     for(auto const& weight : weights) {
       if(!first) {
         ss_ << ", ";
@@ -19,8 +19,10 @@
 #include "dawn/CodeGen/CodeGenProperties.h"
 #include "dawn/IIR/Interval.h"
 #include "dawn/Support/StringUtil.h"
+#include <map>
 #include <stack>
 #include <unordered_map>
+#include <vector>
 
 namespace dawn {
 
@@ -50,6 +52,13 @@ protected:
 
   StencilContext stencilContext_;
 
+  /// Emit neighbor chains as template arguments of `reduce` and weights as `std::array`
+  bool staticNbhChains_;
+
+  /// Neighbor lists (see `dawn::NeighborList`) looked up before the vertical loop, by the chains
+  /// of the reductions over the neighbors of the stage location
+  std::map<std::vector<ast::LocationType>, std::string> nbhLists_;
+
   ///
   /// @brief produces a string of (i,j,k) accesses for the C++ generated naive code,
   /// from an array of offseted accesses
@@ -76,7 +85,8 @@ public:
   using Base::visit;
 
   /// @brief constructor
-  ASTStencilBody(const iir::StencilMetaInformation& metadata, StencilContext stencilContext);
+  ASTStencilBody(const iir::StencilMetaInformation& metadata, StencilContext stencilContext,
+                 bool staticNbhChains = false);
 
   virtual ~ASTStencilBody();
 
@@ -101,6 +111,15 @@ public:
   void setCurrentStencilFunction(
       const std::shared_ptr<iir::StencilFunctionInstantiation>& currentFunction);
 
+  /// @brief Reduce over the neighbor list `nbhLists[chain]` instead of looking up the neighbors
+  /// in reductions over `chain` starting at the stage location
+  void setNeighborLists(std::map<std::vector<ast::LocationType>, std::string> nbhLists) {
+    nbhLists_ = std::move(nbhLists);
+  }
+
+  /// @brief Code looking up the neighbor list of the stage location along `chain`
+  std::string getNeighborListLookup(const std::vector<ast::LocationType>& chain) const;
+
   /// @brief Mapping of VarDeclStmt and Var/FieldAccessExpr to their name
   std::string getName(const std::shared_ptr<iir::Expr>& expr) const override;
   std::string getName(const std::shared_ptr<iir::VarDeclStmt>& stmt) const override;
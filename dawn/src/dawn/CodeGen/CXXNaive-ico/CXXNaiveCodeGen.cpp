@@ -23,6 +23,8 @@
 #include "dawn/Support/Logging.h"
 #include "dawn/Support/StringUtil.h"
 #include <algorithm>
+#include <functional>
+#include <map>
 #include <vector>
 
 namespace dawn {
@@ -49,6 +51,8 @@ namespace cxxnaiveico {
 //     for (auto&& x : get<Locations>(...)) needs to be well-defined such that deref(x) returns
 //     an object of <Location>Type
 //
+//   With OpenMP loops, the object additionally needs to provide size() and operator[](int).
+//
 // - A function `<Location>Type const& deref(X const& x)` should be defined,
 //   where X is decltype(*get<Locations>(...).begin())
 //
@@ -64,6 +68,26 @@ namespace cxxnaiveico {
 //
 //   where Op must be callable as
 //     Op(Init, ValueType);
+//
+// - With static neighbor chains, the chain is passed as template arguments and the weights as an
+//   array instead:
+//
+//   template<dawn::LocationType... Chain, typename Init, typename Op>
+//   Init reduce(Tag, MeshType, reduceTo, Init, Op)
+//
+//   template<dawn::LocationType... Chain, typename Init, typename Op, typename Weight, size_t N>
+//   Init reduce(Tag, MeshType, reduceTo, Init, Op, std::array<Weight, N>)
+//
+// - With k-inner loops, the neighbors of the reductions starting at the stage location are looked
+//   up once per column, with either of
+//
+//   dawn::NeighborList getNeighborList(Tag, MeshType, reduceTo, std::vector<dawn::LocationType>)
+//
+//   template<dawn::LocationType... Chain>
+//   dawn::NeighborList getNeighborList(Tag, MeshType, reduceTo)
+//
+//   and reduced over by the `reduce` overloads taking a `dawn::NeighborList` in
+//   unstructured_interface.hpp.
 
 namespace {
 std::string makeLoopImpl(int iExtent, int jExtent, const std::string& dim, const std::string& lower,
@@ -79,6 +103,22 @@ std::string makeIntervalBound(iir::Interval const& interval, iir::Interval::Boun
              : std::to_string(interval.bound(bound));
 }
 
+// A stage can be executed in parallel over its locations if no field it writes is accessed at a
+// neighboring location within the stage, i.e. all its writes only touch the current location.
+bool isHorizontallyParallel(const iir::Stage& stage) {
+  for(const auto& accessIDFieldPair : stage.getFields()) {
+    const iir::Field& field = accessIDFieldPair.second;
+    if(field.getIntend() == iir::Field::IntendKind::Input)
+      continue;
+    const auto& readExtents = field.getReadExtents();
+    const auto& writeExtents = field.getWriteExtents();
+    if((readExtents && !readExtents->isHorizontalPointwise()) ||
+       (writeExtents && !writeExtents->isHorizontalPointwise()))
+      return false;
+  }
+  return true;
+}
+
 std::string makeKLoop(bool isBackward, iir::Interval const& interval) {
 
   const std::string lower = makeIntervalBound(interval, iir::Interval::Bound::lower);
@@ -90,8 +130,11 @@ std::string makeKLoop(bool isBackward, iir::Interval const& interval) {
 } // namespace
 
 CXXNaiveIcoCodeGen::CXXNaiveIcoCodeGen(const stencilInstantiationContext& ctx,
-                                       DiagnosticsEngine& engine, int maxHaloPoint)
-    : CodeGen(ctx, engine, maxHaloPoint) {}
+                                       DiagnosticsEngine& engine, int maxHaloPoint,
+                                       bool staticNbhChains, bool kInnerLoops,
+                                       bool openMPLoops, bool timers)
+    : CodeGen(ctx, engine, maxHaloPoint), staticNbhChains_(staticNbhChains),
+      kInnerLoops_(kInnerLoops), openMPLoops_(openMPLoops), timers_(timers) {}
 
 CXXNaiveIcoCodeGen::~CXXNaiveIcoCodeGen() {}
 
@@ -253,15 +296,20 @@ void CXXNaiveIcoCodeGen::generateStencilWrapperMembers(
     stencilWrapperClass.addMember("globals", "m_globals");
   }
 
+  std::vector<std::string> stencilMembers;
   for(auto stencilPropertiesPair :
       codeGenProperties.stencilProperties(StencilContext::SC_Stencil)) {
     stencilWrapperClass.addMember(stencilPropertiesPair.second->name_,
                                   "m_" + stencilPropertiesPair.second->name_);
+    stencilMembers.push_back("m_" + stencilPropertiesPair.second->name_);
   }
 
   stencilWrapperClass.changeAccessibility("public");
   stencilWrapperClass.addCopyConstructor(Class::ConstructorDefaultKind::Deleted);
 
+  if(timers_)
+    generateTimersAPI(stencilWrapperClass, stencilMembers);
+
   stencilWrapperClass.addComment("Members");
   //
   // Members
@@ -292,6 +340,19 @@ public:
     return *foundReduction_.value();
   }
 };
+
+// Collects the neighbor chains of the reductions over the neighbors of the stage location, i.e. of
+// the reductions which are not nested in another one
+class CollectNbhChains : public ast::ASTVisitorForwarding {
+  std::vector<std::vector<ast::LocationType>> chains_;
+
+public:
+  void visit(const std::shared_ptr<iir::ReductionOverNeighborExpr>& expr) override {
+    if(std::find(chains_.begin(), chains_.end(), expr->getNbhChain()) == chains_.end())
+      chains_.push_back(expr->getNbhChain());
+  }
+  const std::vector<std::vector<ast::LocationType>>& getChains() const { return chains_; }
+};
 } // namespace
 
 void CXXNaiveIcoCodeGen::generateStencilClasses(
@@ -364,10 +425,12 @@ void CXXNaiveIcoCodeGen::generateStencilClasses(
                        "dimensions, and vice versa!\n");
     }
 
-    Structure stencilClass = stencilWrapperClass.addStruct(stencilName);
+    Structure stencilClass = stencilWrapperClass.addStruct(
+        stencilName, Twine::createNull(),
+        timers_ ? Twine(timerTypename_) : Twine::createNull());
 
     ASTStencilBody stencilBodyCXXVisitor(stencilInstantiation->getMetaData(),
-                                         StencilContext::SC_Stencil);
+                                         StencilContext::SC_Stencil, staticNbhChains_);
 
     auto fieldInfoToDeclString = [](iir::Stencil::FieldInfo info) {
       const auto& unstructuredDims = sir::dimension_cast<sir::UnstructuredFieldDimension const&>(
@@ -423,6 +486,9 @@ void CXXNaiveIcoCodeGen::generateStencilClasses(
     //   stencilClassCtr.addArg("m_globals(globals_)");
     // }
 
+    if(timers_) {
+      stencilClassCtr.addInit(timerTypename_ + "(\"" + stencilName + "\")");
+    }
     stencilClassCtr.addInit("m_mesh(mesh)");
     stencilClassCtr.addInit("m_k_size(k_size)");
     for(auto fieldIt : nonTempFields) {
@@ -450,14 +516,24 @@ void CXXNaiveIcoCodeGen::generateStencilClasses(
     // accumulated extents of API fields
     generateFieldExtentsInfo(stencilClass, nonTempFields, ast::GridType::Unstructured);
 
+    if(timers_)
+      addTimers(stencilClass, *stencil);
+
     //
     // Run-Method
     //
     MemberFunction StencilRunMethod = stencilClass.addMemberFunction("void", "run", "");
     StencilRunMethod.startBody();
+    if(timers_)
+      StencilRunMethod.addStatement("start()");
 
     // TODO the generic deref should be moved to a different namespace
     StencilRunMethod.addStatement("using dawn::deref");
+    if(staticNbhChains_) {
+      StencilRunMethod.addStatement("using dawn::reduce");
+      if(kInnerLoops_)
+        StencilRunMethod.addStatement("using dawn::getNeighborList");
+    }
 
     // StencilRunMethod.addStatement("sync_storages()");
     for(const auto& multiStagePtr : stencil->getChildren()) {
@@ -487,76 +563,177 @@ void CXXNaiveIcoCodeGen::generateStencilClasses(
       if((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward))
         std::reverse(partitionIntervals.begin(), partitionIntervals.end());
 
-      auto getLoop = [](ast::LocationType type) {
+      if(timers_)
+        StencilRunMethod.addStatement(getTimerName(multiStage) + ".start()");
+
+      auto getLocations = [](ast::LocationType type) {
         switch(type) {
         case ast::LocationType::Cells:
-          return "for(auto const& loc : getCells(LibTag{}, m_mesh))";
+          return "getCells(LibTag{}, m_mesh)";
         case ast::LocationType::Vertices:
-          return "for(auto const& loc : getVertices(LibTag{}, m_mesh))";
+          return "getVertices(LibTag{}, m_mesh)";
         case ast::LocationType::Edges:
-          return "for(auto const& loc : getEdges(LibTag{}, m_mesh))";
+          return "getEdges(LibTag{}, m_mesh)";
         default:
           dawn_unreachable("invalid type");
           return "";
         }
       };
 
-      for(auto interval : partitionIntervals) {
+      // whether the loops are emitted within an OpenMP parallel region, where they are shared by
+      // the threads of the region
+      bool inParallelRegion = false;
+
+      // emits the loop over the locations of a stage. Stages without horizontal dependencies are
+      // distributed over OpenMP threads, everything declared in the loop body (including
+      // m_sparse_dimension_idx) is thus private to an iteration. Within a parallel region, the
+      // other stages are run by a single thread.
+      auto addHorizontalLoopImpl = [&](const iir::Stage& stage,
+                                       const std::function<void()>& body) {
+        DAWN_ASSERT_MSG(stage.getLocationType().has_value(), "Stage must have a location type");
+        const std::string locations = getLocations(*stage.getLocationType());
+        if(!openMPLoops_ || !isHorizontallyParallel(stage)) {
+          if(inParallelRegion)
+            StencilRunMethod.ss() << "#pragma omp single\n";
+          StencilRunMethod.addBlockStatement("for(auto const& loc : " + locations + ")", body);
+          return;
+        }
+        StencilRunMethod.ss() << "{\n";
+        StencilRunMethod.addStatement("auto&& locs = " + locations);
+        StencilRunMethod.ss() << (inParallelRegion ? "#pragma omp for\n"
+                                                   : "#pragma omp parallel for\n");
         StencilRunMethod.addBlockStatement(
-            makeKLoop((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward), interval), [&] {
-              // for each interval, we generate naive nested loops
-              for(const auto& stagePtr : multiStage.getChildren()) {
-                const iir::Stage& stage = *stagePtr;
-
-                DAWN_ASSERT_MSG(stage.getLocationType().has_value(),
-                                "Stage must have a location type");
-                std::string loopCode = getLoop(*stage.getLocationType());
-                StencilRunMethod.addBlockStatement(loopCode, [&] {
-                  // Generate Do-Method
-                  for(const auto& doMethodPtr : stage.getChildren()) {
-                    const iir::DoMethod& doMethod = *doMethodPtr;
-                    if(!doMethod.getInterval().overlaps(interval))
-                      continue;
-
-                    bool needsSparseDimIdx = false;
-                    for(const auto& stmt : doMethod.getAST().getStatements()) {
-                      FindReduceOverNeighborExpr findReduceOverNeighborExpr;
-                      stmt->accept(findReduceOverNeighborExpr);
-                      if(findReduceOverNeighborExpr.hasReduceOverNeighborExpr()) {
-                        needsSparseDimIdx = true;
-                        break;
-                      }
-                    }
-
-                    if(needsSparseDimIdx) {
-                      StencilRunMethod.ss() << "int m_sparse_dimension_idx = 0;\n";
-                    }
-
-                    bool firstReduceExpr = true;
-                    for(const auto& stmt : doMethod.getAST().getStatements()) {
-
-                      // if this statement contains a ReduceOverNeighbrExpr but isnt the
-                      // first one we need to reset the neighborhood iterator
-                      FindReduceOverNeighborExpr findReduceOverNeighborExpr;
-                      stmt->accept(findReduceOverNeighborExpr);
-                      if(findReduceOverNeighborExpr.hasReduceOverNeighborExpr()) {
-                        if(!firstReduceExpr) {
-                          StencilRunMethod.ss() << "m_sparse_dimension_idx = 0;\n";
-                        }
-                        firstReduceExpr = false;
-                      }
-
-                      stmt->accept(stencilBodyCXXVisitor);
-                      StencilRunMethod << stencilBodyCXXVisitor.getCodeAndResetStream();
-                    }
-                  }
-                });
-              }
+            "for(int loc_idx = 0; loc_idx < int(locs.size()); ++loc_idx)", [&] {
+              StencilRunMethod.addStatement("auto const& loc = locs[loc_idx]");
+              body();
             });
+        StencilRunMethod.ss() << "}\n";
+      };
+
+      // times the loop over the locations of a stage. If the vertical loop is outermost, the timer
+      // accumulates the loops of all vertical levels.
+      auto addHorizontalLoop = [&](const iir::Stage& stage, const std::function<void()>& body) {
+        if(timers_) {
+          if(inParallelRegion)
+            StencilRunMethod.ss() << "#pragma omp master\n";
+          StencilRunMethod.addStatement(getTimerName(stage) + ".start()");
+        }
+        addHorizontalLoopImpl(stage, body);
+        if(timers_) {
+          if(inParallelRegion)
+            StencilRunMethod.ss() << "#pragma omp master\n";
+          StencilRunMethod.addStatement(getTimerName(stage) + ".pause()");
+        }
+      };
+
+      // emits the do-methods of a stage overlapping with the interval, within the loops over the
+      // horizontal and vertical dimension
+      auto generateDoMethods = [&](const iir::Stage& stage, const iir::Interval& interval) {
+        for(const auto& doMethodPtr : stage.getChildren()) {
+          const iir::DoMethod& doMethod = *doMethodPtr;
+          if(!doMethod.getInterval().overlaps(interval))
+            continue;
+
+          bool needsSparseDimIdx = false;
+          for(const auto& stmt : doMethod.getAST().getStatements()) {
+            FindReduceOverNeighborExpr findReduceOverNeighborExpr;
+            stmt->accept(findReduceOverNeighborExpr);
+            if(findReduceOverNeighborExpr.hasReduceOverNeighborExpr()) {
+              needsSparseDimIdx = true;
+              break;
+            }
+          }
+
+          if(needsSparseDimIdx) {
+            StencilRunMethod.ss() << "int m_sparse_dimension_idx = 0;\n";
+          }
+
+          bool firstReduceExpr = true;
+          for(const auto& stmt : doMethod.getAST().getStatements()) {
+
+            // if this statement contains a ReduceOverNeighbrExpr but isnt the
+            // first one we need to reset the neighborhood iterator
+            FindReduceOverNeighborExpr findReduceOverNeighborExpr;
+            stmt->accept(findReduceOverNeighborExpr);
+            if(findReduceOverNeighborExpr.hasReduceOverNeighborExpr()) {
+              if(!firstReduceExpr) {
+                StencilRunMethod.ss() << "m_sparse_dimension_idx = 0;\n";
+              }
+              firstReduceExpr = false;
+            }
+
+            stmt->accept(stencilBodyCXXVisitor);
+            StencilRunMethod << stencilBodyCXXVisitor.getCodeAndResetStream();
+          }
+        }
+      };
+
+      // Within a parallel multistage, no stage depends on the vertical iteration order, hence the
+      // vertical loop can be moved inside of the horizontal one. Each stage is then computed on
+      // the full vertical domain before the next one starts, and the neighbors of its reductions
+      // are looked up once per column instead of once per level.
+      if(kInnerLoops_ && multiStage.getLoopOrder() == iir::LoopOrderKind::Parallel) {
+        for(const auto& stagePtr : multiStage.getChildren()) {
+          const iir::Stage& stage = *stagePtr;
+          addHorizontalLoop(stage, [&] {
+            CollectNbhChains collectNbhChains;
+            for(const auto& doMethodPtr : stage.getChildren())
+              for(const auto& stmt : doMethodPtr->getAST().getStatements())
+                stmt->accept(collectNbhChains);
+
+            std::map<std::vector<ast::LocationType>, std::string> nbhLists;
+            for(const auto& chain : collectNbhChains.getChains()) {
+              const std::string name = "nbhs_" + std::to_string(nbhLists.size());
+              StencilRunMethod.addStatement("auto const " + name + " = " +
+                                            stencilBodyCXXVisitor.getNeighborListLookup(chain));
+              nbhLists.emplace(chain, name);
+            }
+            stencilBodyCXXVisitor.setNeighborLists(std::move(nbhLists));
+
+            for(auto interval : partitionIntervals) {
+              if(std::none_of(stage.childrenBegin(), stage.childrenEnd(),
+                              [&](const std::unique_ptr<iir::DoMethod>& doMethod) {
+                                return doMethod->getInterval().overlaps(interval);
+                              }))
+                continue;
+              StencilRunMethod.addBlockStatement(makeKLoop(false, interval),
+                                                 [&] { generateDoMethods(stage, interval); });
+            }
+            stencilBodyCXXVisitor.setNeighborLists({});
+          });
+        }
+      } else {
+        // The threads are forked once for the multistage instead of for every vertical level and
+        // stage. Every thread runs the vertical loops, and the loops over the locations are shared
+        // among the threads. The implicit barrier at the end of each of them orders the stages.
+        inParallelRegion =
+            openMPLoops_ && std::any_of(multiStage.childrenBegin(), multiStage.childrenEnd(),
+                                        [](const std::unique_ptr<iir::Stage>& stage) {
+                                          return isHorizontallyParallel(*stage);
+                                        });
+        if(inParallelRegion)
+          StencilRunMethod.ss() << "#pragma omp parallel\n{\n";
+        for(auto interval : partitionIntervals) {
+          StencilRunMethod.addBlockStatement(
+              makeKLoop((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward), interval),
+              [&] {
+                // for each interval, we generate naive nested loops
+                for(const auto& stagePtr : multiStage.getChildren()) {
+                  addHorizontalLoop(*stagePtr, [&] { generateDoMethods(*stagePtr, interval); });
+                }
+              });
+        }
+        if(inParallelRegion)
+          StencilRunMethod.ss() << "}\n";
+        inParallelRegion = false;
       }
+      if(timers_)
+        StencilRunMethod.addStatement(getTimerName(multiStage) + ".pause()");
       StencilRunMethod.ss() << "}";
     }
     StencilRunMethod.addStatement("sync_storages()");
+    if(timers_)
+      StencilRunMethod.addStatement("pause()");
     StencilRunMethod.commit();
   }
 }
@@ -631,9 +808,12 @@ void CXXNaiveIcoCodeGen::generateStencilFunctions(
         stencilFunMethod.addArg("const globals& m_globals");
       }
       ASTStencilBody stencilBodyCXXVisitor(stencilInstantiation->getMetaData(),
-                                           StencilContext::SC_StencilFunction);
+                                           StencilContext::SC_StencilFunction, staticNbhChains_);
 
       stencilFunMethod.startBody();
+      if(staticNbhChains_) {
+        stencilFunMethod.addStatement("using dawn::reduce");
+      }
 
       for(std::size_t m = 0; m < fields.size(); ++m) {
 
@@ -680,6 +860,10 @@ std::unique_ptr<TranslationUnit> CXXNaiveIcoCodeGen::generateCode() {
   ppDefines.push_back("#undef DAWN_BACKEND_T");
   ppDefines.push_back("#define DAWN_BACKEND_T CXXNAIVEICO");
   ppDefines.push_back("#include <driver-includes/unstructured_interface.hpp>");
+  if(timers_) {
+    ppDefines.push_back("#include <driver-includes/timer_x86.hpp>");
+    ppDefines.push_back("#include <map>");
+  }
   DAWN_LOG(INFO) << "Done generating code";
 
   std::string filename = generateFileName(context_);
@@ -38,7 +38,8 @@ class CXXNaiveIcoCodeGen : public CodeGen {
 public:
   ///@brief constructor
   CXXNaiveIcoCodeGen(const stencilInstantiationContext& ctx, DiagnosticsEngine& engine,
-                     int maxHaloPoint);
+                     int maxHaloPoint, bool staticNbhChains = false, bool kInnerLoops = false,
+                     bool openMPLoops = false, bool timers = false);
   virtual ~CXXNaiveIcoCodeGen();
   virtual std::unique_ptr<TranslationUnit> generateCode() override;
 
@@ -68,6 +69,18 @@ private:
   generateStencilWrapperRun(Class& stencilWrapperClass,
                             const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
                             const CodeGenProperties& codeGenProperties) const;
+
+  /// Pass neighbor chains of reductions as template arguments (see `ASTStencilBody`)
+  bool staticNbhChains_;
+
+  /// Generate the vertical loops inside of the horizontal ones in parallel multistages
+  bool kInnerLoops_;
+
+  /// Distribute the horizontal loops of stages without horizontal dependencies over OpenMP threads
+  bool openMPLoops_;
+
+  /// Time each stencil, multistage and stage loop nest (see `CodeGen::addTimers`)
+  bool timers_;
 };
 } // namespace cxxnaiveico
 } // namespace codegen
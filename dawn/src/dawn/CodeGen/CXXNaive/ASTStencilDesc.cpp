@@ -72,7 +72,7 @@ void ASTStencilDesc::visit(const std::shared_ptr<iir::StencilCallDeclStmt>& stmt
 
   ss_ << fieldArgs(nonTempFields, [&](const std::pair<const int, iir::Stencil::FieldInfo>& fieldp) {
     if(metadata_.isAccessType(iir::FieldAccessType::InterStencilTemporary, fieldp.first)) {
-      return "m_" + fieldp.second.Name;
+      return "m_" + codeGenProperties_.getAllocatedStorage(fieldp.second.Name);
     } else {
       return fieldp.second.Name;
     }
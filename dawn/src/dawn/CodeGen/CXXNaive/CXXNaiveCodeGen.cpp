@@ -29,6 +29,8 @@
 #include "dawn/Support/Logging.h"
 #include "dawn/Support/StringUtil.h"
 #include <algorithm>
+#include <cctype>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -45,9 +47,9 @@ std::string makeLoopImpl(int lowerExtent, int upperExtent, const std::string& di
          ")";
 }
 
-std::string makeIJLoop(int lowerExtent, int upperExtent, const std::string dom,
-                       const std::string& dim) {
-  return makeLoopImpl(lowerExtent, upperExtent, dim, dim + "Min", dim + "Max", " <= ", "++");
+std::string makeIJLoop(const std::string& dim, const std::pair<std::string, std::string>& bounds) {
+  return "for(int " + dim + " = " + bounds.first + "; " + dim + "  <=  " + bounds.second + "; ++" +
+         dim + ")";
 }
 
 std::string makeIntervalBoundReadable(std::string dim, const iir::Interval& interval,
@@ -85,8 +87,13 @@ std::string makeKLoop(bool isBackward, iir::Interval const& interval) {
 } // namespace
 
 CXXNaiveCodeGen::CXXNaiveCodeGen(const stencilInstantiationContext& ctx, DiagnosticsEngine& engine,
-                                 int maxHaloPoint)
-    : CodeGen(ctx, engine, maxHaloPoint) {}
+                                 int maxHaloPoint, std::string loopOrder, bool timers)
+    : CodeGen(ctx, engine, maxHaloPoint), loopOrder_(loopOrder), timers_(timers) {
+  const std::string dims = "ijk";
+  DAWN_ASSERT_MSG(loopOrder_.size() == dims.size() &&
+                      std::is_permutation(loopOrder_.begin(), loopOrder_.end(), dims.begin()),
+                  "loop order must be a permutation of \"ijk\"");
+}
 
 CXXNaiveCodeGen::~CXXNaiveCodeGen() {}
 
@@ -97,7 +104,7 @@ std::string CXXNaiveCodeGen::generateStencilInstantiation(
   std::stringstream ssSW;
 
   Namespace dawnNamespace("dawn_generated", ssSW);
-  Namespace cxxnaiveNamespace("cxxnaive", ssSW);
+  Namespace backendNamespace(getBackendName(), ssSW);
 
   const auto& globalsMap = stencilInstantiation->getIIR()->getGlobalVariableMap();
 
@@ -120,7 +127,7 @@ std::string CXXNaiveCodeGen::generateStencilInstantiation(
 
   stencilWrapperClass.commit();
 
-  cxxnaiveNamespace.commit();
+  backendNamespace.commit();
   dawnNamespace.commit();
 
   return ssSW.str();
@@ -163,7 +170,6 @@ void CXXNaiveCodeGen::generateStencilWrapperCtr(
     const CodeGenProperties& codeGenProperties) const {
 
   const auto& stencils = stencilInstantiation->getStencils();
-  const auto& metadata = stencilInstantiation->getMetaData();
   const auto& globalsMap = stencilInstantiation->getIIR()->getGlobalVariableMap();
 
   // Generate stencil wrapper constructor
@@ -196,12 +202,10 @@ void CXXNaiveCodeGen::generateStencilWrapperCtr(
     StencilWrapperConstructor.addInit(initCtr);
   }
 
-  if(metadata.hasAccessesOfType<iir::FieldAccessType::InterStencilTemporary>()) {
-    std::vector<std::string> tempFields;
-    for(auto accessID : metadata.getAccessesOfType<iir::FieldAccessType::InterStencilTemporary>()) {
-      tempFields.push_back(metadata.getFieldNameFromAccessID(accessID));
-    }
-    addTmpStorageInitStencilWrapperCtr(StencilWrapperConstructor, stencils, tempFields);
+  if(codeGenProperties.hasAllocatedFields()) {
+    const std::set<std::string> storages = codeGenProperties.getAllocatedStorages();
+    addTmpStorageInitStencilWrapperCtr(StencilWrapperConstructor, stencils,
+                                       std::vector<std::string>(storages.begin(), storages.end()));
   }
   StencilWrapperConstructor.startBody();
   StencilWrapperConstructor.addStatement("assert(dom.isize() >= dom.iminus() + dom.iplus())");
@@ -217,7 +221,6 @@ void CXXNaiveCodeGen::generateStencilWrapperMembers(
     const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
     CodeGenProperties& codeGenProperties) const {
 
-  const auto& metadata = stencilInstantiation->getMetaData();
   const auto& globalsMap = stencilInstantiation->getIIR()->getGlobalVariableMap();
 
   stencilWrapperClass.addMember("static constexpr const char* s_name =",
@@ -227,26 +230,31 @@ void CXXNaiveCodeGen::generateStencilWrapperMembers(
     stencilWrapperClass.addMember("globals", "m_globals");
   }
 
+  std::vector<std::string> stencilMembers;
   for(auto stencilPropertiesPair :
       codeGenProperties.stencilProperties(StencilContext::SC_Stencil)) {
     stencilWrapperClass.addMember(stencilPropertiesPair.second->name_,
                                   "m_" + stencilPropertiesPair.second->name_);
+    stencilMembers.push_back("m_" + stencilPropertiesPair.second->name_);
   }
 
   stencilWrapperClass.changeAccessibility("public");
   stencilWrapperClass.addCopyConstructor(Class::ConstructorDefaultKind::Deleted);
+
+  if(timers_)
+    generateTimersAPI(stencilWrapperClass, stencilMembers);
   //
   // Members
   //
   // Define allocated memebers if necessary
-  if(metadata.hasAccessesOfType<iir::FieldAccessType::InterStencilTemporary>()) {
+  // Inter-stencil temporaries with disjoint lifetimes share their storages
+  if(codeGenProperties.hasAllocatedFields()) {
     stencilWrapperClass.addComment("Members");
 
     stencilWrapperClass.addMember(c_dgt() + "meta_data_t", "m_meta_data");
 
-    for(int AccessID : metadata.getAccessesOfType<iir::FieldAccessType::InterStencilTemporary>())
-      stencilWrapperClass.addMember(c_dgt() + "storage_t",
-                                    "m_" + metadata.getFieldNameFromAccessID(AccessID));
+    for(const auto& storageName : codeGenProperties.getAllocatedStorages())
+      stencilWrapperClass.addMember(c_dgt() + "storage_t", "m_" + storageName);
   }
 }
 void CXXNaiveCodeGen::generateStencilClasses(
@@ -277,20 +285,20 @@ void CXXNaiveCodeGen::generateStencilClasses(
         makeRange(stencilFields, [](std::pair<int, iir::Stencil::FieldInfo> const& p) {
           return !p.second.IsTemporary;
         });
+    const std::set<int> scratchTemporaries = getScratchTemporaries(stencil);
     auto tempFields =
-        makeRange(stencilFields, [](std::pair<int, iir::Stencil::FieldInfo> const& p) {
-          return p.second.IsTemporary;
+        makeRange(stencilFields, [&](std::pair<int, iir::Stencil::FieldInfo> const& p) {
+          return p.second.IsTemporary && !scratchTemporaries.count(p.first);
         });
 
-    Structure stencilClass = stencilWrapperClass.addStruct(stencilName);
-
-    ASTStencilBody stencilBodyCXXVisitor(stencilInstantiation->getMetaData(),
-                                         StencilContext::SC_Stencil);
+    Structure stencilClass = stencilWrapperClass.addStruct(
+        stencilName, Twine::createNull(),
+        timers_ ? Twine(timerTypename_) : Twine::createNull());
 
     stencilClass.addComment("Members");
     bool iterationSpaceSet = hasGlobalIndices(stencil);
     if(iterationSpaceSet) {
-      generateGlobalIndices(stencil, stencilClass);
+      generateGlobalIndices(stencil, stencilClass, false);
     }
 
     stencilClass.addComment("Temporary storages");
@@ -318,6 +326,9 @@ void CXXNaiveCodeGen::generateStencilClasses(
     stencilClassCtr.addArg("int xcols");
     stencilClassCtr.addArg("int ycols");
 
+    if(timers_) {
+      stencilClassCtr.addInit(timerTypename_ + "(\"" + stencilName + "\")");
+    }
     stencilClassCtr.addInit("m_dom(dom_)");
     if(!globalsMap.empty()) {
       stencilClassCtr.addArg("m_globals(globals_)");
@@ -359,6 +370,9 @@ void CXXNaiveCodeGen::generateStencilClasses(
     // accumulated extents of API fields
     generateFieldExtentsInfo(stencilClass, nonTempFields, ast::GridType::Cartesian);
 
+    if(timers_)
+      addTimers(stencilClass, stencil);
+
     //
     // Run-Method
     //
@@ -369,6 +383,8 @@ void CXXNaiveCodeGen::generateStencilClasses(
     }
 
     stencilRunMethod.startBody();
+    if(timers_)
+      stencilRunMethod.addStatement("start()");
     // Compute the loop bounds for readability
     stencilRunMethod.addStatement("int iMin = m_dom.iminus()");
     stencilRunMethod.addStatement("int iMax = m_dom.isize() - m_dom.iplus() - 1");
@@ -401,92 +417,137 @@ void CXXNaiveCodeGen::generateStencilClasses(
         stencilRunMethod.addStatement("std::array<int,3> " + fieldName + "_offsets{0,0,0}");
       }
 
-      auto intervals_set = multiStage.getIntervals();
-      std::vector<iir::Interval> intervals_v;
-      std::copy(intervals_set.begin(), intervals_set.end(), std::back_inserter(intervals_v));
-
-      // compute the partition of the intervals
-      auto partitionIntervals = iir::Interval::computePartition(intervals_v);
-      if((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward))
-        std::reverse(partitionIntervals.begin(), partitionIntervals.end());
-
-      for(auto interval : partitionIntervals) {
-
-        // for each interval, we generate naive nested loops
-        stencilRunMethod.addBlockStatement(
-            makeKLoop((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward), interval),
-            [&]() {
-              for(const auto& stagePtr : multiStage.getChildren()) {
-                iir::Stage& stage = *stagePtr;
-
-                auto const& extents = iir::extent_cast<iir::CartesianExtent const&>(
-                    stage.getExtents().horizontalExtent());
-
-                // Check if we need to execute this statement:
-                bool hasOverlappingInterval = false;
-                for(const auto& doMethodPtr : stage.getChildren()) {
-                  hasOverlappingInterval |= (doMethodPtr->getInterval().overlaps(interval));
-                }
-
-                if(hasOverlappingInterval) {
-                  auto doMethodGenerator = [&]() {
-                    // Generate Do-Method
-                    for(const auto& doMethodPtr : stage.getChildren()) {
-                      const iir::DoMethod& doMethod = *doMethodPtr;
-                      if(!doMethod.getInterval().overlaps(interval))
-                        continue;
-                      for(const auto& stmt : doMethod.getAST().getStatements()) {
-                        stmt->accept(stencilBodyCXXVisitor);
-                        stencilRunMethod << stencilBodyCXXVisitor.getCodeAndResetStream();
-                      }
-                    }
-                  };
-
-                  stencilRunMethod.addBlockStatement(
-                      makeIJLoop(extents.iMinus(), extents.iPlus(), "m_dom", "i"), [&]() {
-                        stencilRunMethod.addBlockStatement(
-                            makeIJLoop(extents.jMinus(), extents.jPlus(), "m_dom", "j"), [&] {
-                              if(std::any_of(stage.getIterationSpace().cbegin(),
-                                             stage.getIterationSpace().cend(),
-                                             [](const auto& p) -> bool { return p.has_value(); })) {
-                                std::string conditional = "if(";
-                                if(stage.getIterationSpace()[0]) {
-                                  conditional += "checkOffset(stage" +
-                                                 std::to_string(stage.getStageID()) +
-                                                 "GlobalIIndices[0], stage" +
-                                                 std::to_string(stage.getStageID()) +
-                                                 "GlobalIIndices[1], globalOffsets[0] + i)";
-                                }
-                                if(stage.getIterationSpace()[1]) {
-                                  if(stage.getIterationSpace()[0]) {
-                                    conditional += " && ";
-                                  }
-                                  conditional += "checkOffset(stage" +
-                                                 std::to_string(stage.getStageID()) +
-                                                 "GlobalJIndices[0], stage" +
-                                                 std::to_string(stage.getStageID()) +
-                                                 "GlobalJIndices[1], globalOffsets[1] + j)";
-                                }
-                                conditional += ")";
-                                stencilRunMethod.addBlockStatement(conditional, doMethodGenerator);
-                              } else {
-                                doMethodGenerator();
-                              }
-                            });
-                      });
-                }
-              }
-            });
-      }
+      if(timers_)
+        stencilRunMethod.addStatement(getTimerName(multiStage) + ".start()");
+      generateMultiStage(stencilRunMethod, stencilInstantiation, multiStage);
+      if(timers_)
+        stencilRunMethod.addStatement(getTimerName(multiStage) + ".pause()");
       stencilRunMethod.ss() << "}";
     }
     for(const auto& fieldPair : nonTempFields) {
       stencilRunMethod.addStatement(fieldPair.second.Name + "_" + ".sync()");
     }
+    if(timers_)
+      stencilRunMethod.addStatement("pause()");
     stencilRunMethod.commit();
   }
 }
 
+std::pair<std::string, std::string>
+CXXNaiveCodeGen::makeIterationSpaceBounds(const iir::Stage& stage, const std::string& dim,
+                                          std::string lower, std::string upper) {
+  const int dimIdx = dim == "i" ? 0 : 1;
+  if(stage.getIterationSpace()[dimIdx]) {
+    // the global indices of the iteration space are shifted to the local indices of the rank
+    const std::string indices = "stage" + std::to_string(stage.getStageID()) + "Global" +
+                                (dimIdx == 0 ? "I" : "J") + "Indices";
+    const std::string offset = "int(globalOffsets[" + std::to_string(dimIdx) + "])";
+    lower = "std::max(" + lower + ", " + indices + "[0] - " + offset + ")";
+    upper = "std::min(" + upper + ", " + indices + "[1] - 1 - " + offset + ")";
+  }
+  return {lower, upper};
+}
+
+void CXXNaiveCodeGen::generateMultiStage(
+    MemberFunction& stencilRunMethod,
+    const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
+    const iir::MultiStage& multiStage) const {
+
+  ASTStencilBody stencilBodyCXXVisitor(stencilInstantiation->getMetaData(),
+                                       StencilContext::SC_Stencil);
+
+  auto intervals_set = multiStage.getIntervals();
+  std::vector<iir::Interval> intervals_v;
+  std::copy(intervals_set.begin(), intervals_set.end(), std::back_inserter(intervals_v));
+
+  // compute the partition of the intervals
+  auto partitionIntervals = iir::Interval::computePartition(intervals_v);
+  if((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward))
+    std::reverse(partitionIntervals.begin(), partitionIntervals.end());
+
+  auto isComputedIn = [](const iir::Stage& stage, const iir::Interval& interval) {
+    return std::any_of(stage.childrenBegin(), stage.childrenEnd(),
+                       [&](const std::unique_ptr<iir::DoMethod>& doMethod) {
+                         return doMethod->getInterval().overlaps(interval);
+                       });
+  };
+
+  auto generateDoMethods = [&](const iir::Stage& stage, const iir::Interval& interval) {
+    for(const auto& doMethodPtr : stage.getChildren()) {
+      const iir::DoMethod& doMethod = *doMethodPtr;
+      if(!doMethod.getInterval().overlaps(interval))
+        continue;
+      for(const auto& stmt : doMethod.getAST().getStatements()) {
+        stmt->accept(stencilBodyCXXVisitor);
+        stencilRunMethod << stencilBodyCXXVisitor.getCodeAndResetStream();
+      }
+    }
+  };
+
+  // Nests the loops over the dimensions `dims` (outermost first) of a stage around its do-methods.
+  // The horizontal loops are clipped to the iteration space of the stage, the vertical loop is
+  // split into one loop per interval of the partition the stage is computed in.
+  std::function<void(const iir::Stage&, const std::string&, const iir::Interval*)> addLoops =
+      [&](const iir::Stage& stage, const std::string& dims, const iir::Interval* interval) {
+        if(dims.empty()) {
+          generateDoMethods(stage, *interval);
+          return;
+        }
+        const std::string dim = dims.substr(0, 1);
+        const std::string innerDims = dims.substr(1);
+
+        if(dim == "k") {
+          for(const auto& kInterval : partitionIntervals)
+            if(isComputedIn(stage, kInterval))
+              stencilRunMethod.addBlockStatement(makeKLoop(false, kInterval), [&]() {
+                addLoops(stage, innerDims, &kInterval);
+              });
+          return;
+        }
+
+        auto const& extents =
+            iir::extent_cast<iir::CartesianExtent const&>(stage.getExtents().horizontalExtent());
+        const int lowerExtent = dim == "i" ? extents.iMinus() : extents.jMinus();
+        const int upperExtent = dim == "i" ? extents.iPlus() : extents.jPlus();
+        stencilRunMethod.addBlockStatement(
+            makeIJLoop(dim, makeIterationSpaceBounds(stage, dim,
+                                                     dim + "Min+" + std::to_string(lowerExtent),
+                                                     dim + "Max+" + std::to_string(upperExtent))),
+            [&]() { addLoops(stage, innerDims, interval); });
+      };
+
+  // Times the loop nest of a stage. If the vertical loop is outermost, the timer accumulates the
+  // loop nests of all vertical levels.
+  auto addStageLoops = [&](const iir::Stage& stage, const std::string& dims,
+                           const iir::Interval* interval) {
+    if(timers_)
+      stencilRunMethod.addStatement(getTimerName(stage) + ".start()");
+    addLoops(stage, dims, interval);
+    if(timers_)
+      stencilRunMethod.addStatement(getTimerName(stage) + ".pause()");
+  };
+
+  // Within a parallel multistage, no stage depends on the vertical iteration order, hence the
+  // vertical loop can be nested inside of the horizontal ones (each stage is then computed on the
+  // full vertical domain before the next one starts). Otherwise it is the outermost loop.
+  std::string horizontalOrder = loopOrder_;
+  horizontalOrder.erase(horizontalOrder.find('k'), 1);
+  if(loopOrder_[0] != 'k' && multiStage.getLoopOrder() == iir::LoopOrderKind::Parallel) {
+    for(const auto& stagePtr : multiStage.getChildren())
+      addStageLoops(*stagePtr, loopOrder_, nullptr);
+  } else {
+    for(const auto& interval : partitionIntervals) {
+      // for each interval, we generate naive nested loops
+      stencilRunMethod.addBlockStatement(
+          makeKLoop((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward), interval), [&]() {
+            for(const auto& stagePtr : multiStage.getChildren())
+              if(isComputedIn(*stagePtr, interval))
+                addStageLoops(*stagePtr, horizontalOrder, &interval);
+          });
+    }
+  }
+}
+
 void CXXNaiveCodeGen::generateStencilFunctions(
     Class& stencilWrapperClass,
     const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
@@ -603,7 +664,7 @@ std::unique_ptr<TranslationUnit> CXXNaiveCodeGen::generateCode() {
     stencils.emplace(nameStencilCtxPair.first, std::move(code));
   }
 
-  std::string globals = generateGlobals(context_, "dawn_generated", "cxxnaive");
+  std::string globals = generateGlobals(context_, "dawn_generated", getBackendName());
 
   std::vector<std::string> ppDefines;
   auto makeDefine = [](std::string define, int value) {
@@ -612,7 +673,9 @@ std::unique_ptr<TranslationUnit> CXXNaiveCodeGen::generateCode() {
 
   ppDefines.push_back(makeDefine("DAWN_GENERATED", 1));
   ppDefines.push_back("#undef DAWN_BACKEND_T");
-  ppDefines.push_back("#define DAWN_BACKEND_T CXXNAIVE");
+  std::string backendName = getBackendName();
+  std::transform(backendName.begin(), backendName.end(), backendName.begin(), ::toupper);
+  ppDefines.push_back("#define DAWN_BACKEND_T " + backendName);
   // ==============------------------------------------------------------------------------------===
   // BENCHMARKTODO: since we're importing two cpp files into the benchmark API we need to set
   // these variables also in the naive code-generation in order to not break it. Once the move to
@@ -621,6 +684,10 @@ std::unique_ptr<TranslationUnit> CXXNaiveCodeGen::generateCode() {
   // ==============------------------------------------------------------------------------------===
   CodeGen::addMplIfdefs(ppDefines, 30);
   ppDefines.push_back("#include <driver-includes/gridtools_includes.hpp>");
+  if(timers_) {
+    ppDefines.push_back("#include <driver-includes/timer_x86.hpp>");
+    ppDefines.push_back("#include <map>");
+  }
   ppDefines.push_back("using namespace gridtools::dawn;");
   DAWN_LOG(INFO) << "Done generating code";
 
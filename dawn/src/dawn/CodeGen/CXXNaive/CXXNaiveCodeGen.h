@@ -18,10 +18,12 @@
 #include "dawn/CodeGen/CodeGen.h"
 #include "dawn/CodeGen/CodeGenProperties.h"
 #include "dawn/IIR/Interval.h"
+#include "dawn/IIR/MultiStage.h"
 #include "dawn/Support/IndexRange.h"
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace dawn {
@@ -37,12 +39,46 @@ namespace cxxnaive {
 class CXXNaiveCodeGen : public CodeGen {
 public:
   ///@brief constructor
+  ///
+  /// `loopOrder` is the order of the loops over the dimensions of the stages from the outermost to
+  /// the innermost one. It should end with the stride-1 dimension of the storages (i for the
+  /// layout of the `mc` backend of GridTools). The vertical loop is kept outermost in multistages
+  /// which are not parallel.
+  ///
+  /// With `timers`, each stencil, multistage and stage loop nest is timed (see
+  /// `CodeGen::addTimers`).
   CXXNaiveCodeGen(const stencilInstantiationContext& ctx, DiagnosticsEngine& engine,
-                  int maxHaloPoint);
+                  int maxHaloPoint, std::string loopOrder = "kji", bool timers = false);
   virtual ~CXXNaiveCodeGen();
   virtual std::unique_ptr<TranslationUnit> generateCode() override;
 
+protected:
+  /// @brief Namespace of the generated code within `dawn_generated`, its upper case spelling is
+  /// the value of `DAWN_BACKEND_T`
+  virtual std::string getBackendName() const { return "cxxnaive"; }
+
+  /// @brief Generate the loops of a multistage into the run method of its stencil
+  virtual void
+  generateMultiStage(MemberFunction& stencilRunMethod,
+                     const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
+                     const iir::MultiStage& multiStage) const;
+
+  /// @brief Inclusive bounds of the loop of a stage over the dimension `dim` ("i" or "j") clipped
+  /// to the global iteration space of the stage, `lower` and `upper` are the bounds of the loop if
+  /// the stage has no iteration space in that dimension
+  static std::pair<std::string, std::string> makeIterationSpaceBounds(const iir::Stage& stage,
+                                                                      const std::string& dim,
+                                                                      std::string lower,
+                                                                      std::string upper);
+
+  /// @brief Stencil temporaries which `generateMultiStage` keeps in scratch buffers of its own, no
+  /// temporary storage is allocated for them
+  virtual std::set<int> getScratchTemporaries(const iir::Stencil& stencil) const { return {}; }
+
 private:
+  std::string loopOrder_;
+  bool timers_;
+
   std::string generateStencilInstantiation(
       const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation);
 
@@ -0,0 +1,54 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/CodeGen/CXXOpt/ASTStencilBody.h"
+#include "dawn/AST/Offsets.h"
+#include "dawn/IIR/AST.h"
+#include "dawn/IIR/ASTExpr.h"
+
+namespace dawn {
+namespace codegen {
+namespace cxxopt {
+
+ASTStencilBody::ASTStencilBody(const iir::StencilMetaInformation& metadata,
+                               const std::map<int, TileCache>& tileCaches)
+    : Base(metadata, StencilContext::SC_Stencil), tileCaches_(tileCaches) {}
+
+ASTStencilBody::~ASTStencilBody() {}
+
+void ASTStencilBody::visit(const std::shared_ptr<iir::FieldAccessExpr>& expr) {
+  auto cacheIt = currentFunction_ ? tileCaches_.end() : tileCaches_.find(iir::getAccessID(expr));
+  if(cacheIt == tileCaches_.end()) {
+    Base::visit(expr);
+    return;
+  }
+
+  const TileCache& cache = cacheIt->second;
+  const auto& offset = expr->getOffset();
+  const auto& hOffset = ast::offset_cast<ast::CartesianOffset const&>(offset.horizontalOffset());
+
+  // vertical levels are kept in a ring buffer, indexed by the absolute level
+  std::string slot = "0";
+  if(cache.Slots > 1) {
+    const std::string slots = std::to_string(cache.Slots);
+    slot = "((k+" + std::to_string(offset.verticalOffset()) + ")%" + slots + "+" + slots + ")%" +
+           slots;
+  }
+  ss_ << cache.Name << "[" << slot << "][(j+" << hOffset.offsetJ() << "-jb+" << -cache.JMinus
+      << ")*" << cache.RowSize << "+i+" << hOffset.offsetI() << "-ib+" << -cache.IMinus << "]";
+}
+
+} // namespace cxxopt
+} // namespace codegen
+} // namespace dawn
@@ -0,0 +1,65 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#ifndef DAWN_CODEGEN_CXXOPT_ASTSTENCILBODY_H
+#define DAWN_CODEGEN_CXXOPT_ASTSTENCILBODY_H
+
+#include "dawn/CodeGen/CXXNaive/ASTStencilBody.h"
+#include <string>
+#include <map>
+
+namespace dawn {
+namespace codegen {
+namespace cxxopt {
+
+/// @brief Buffer of a tile replacing the storage of a cached field within a multistage
+///
+/// The buffer holds `Slots` horizontal planes of the tile (including its halo), vertical levels
+/// are mapped to the planes in a ring-buffer fashion.
+/// @ingroup cxxopt
+struct TileCache {
+  std::string Name; ///< Name of the buffer in the generated code
+  int Slots;        ///< Number of vertical levels kept in the buffer
+  int IMinus;       ///< Halo of the buffer in the negative i direction (non-positive)
+  int JMinus;       ///< Halo of the buffer in the negative j direction (non-positive)
+  int RowSize;      ///< Number of points of a row (fixed j) of the buffer
+};
+
+/// @brief ASTVisitor to generate the C++ code of the stencil bodies, accesses to cached fields are
+/// redirected to their tile buffers
+/// @ingroup cxxopt
+class ASTStencilBody : public cxxnaive::ASTStencilBody {
+  const std::map<int, TileCache>& tileCaches_;
+
+public:
+  using Base = cxxnaive::ASTStencilBody;
+  using Base::visit;
+
+  /// @brief constructor
+  ASTStencilBody(const iir::StencilMetaInformation& metadata,
+                 const std::map<int, TileCache>& tileCaches);
+
+  virtual ~ASTStencilBody();
+
+  /// @name Expression implementation
+  /// @{
+  virtual void visit(const std::shared_ptr<iir::FieldAccessExpr>& expr) override;
+  /// @}
+};
+
+} // namespace cxxopt
+} // namespace codegen
+} // namespace dawn
+
+#endif
@@ -0,0 +1,309 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/CodeGen/CXXOpt/CXXOptCodeGen.h"
+#include "dawn/AST/GridType.h"
+#include "dawn/CodeGen/CXXOpt/ASTStencilBody.h"
+#include "dawn/CodeGen/CXXUtil.h"
+#include "dawn/IIR/Cache.h"
+#include "dawn/IIR/Extents.h"
+#include "dawn/IIR/Interval.h"
+#include "dawn/IIR/Stage.h"
+#include "dawn/IIR/Stencil.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace dawn {
+namespace codegen {
+namespace cxxopt {
+
+namespace {
+/// Tile size used if no block size was set (i.e. `PassSetBlockSize` did not run)
+constexpr int defaultBlockSizeI = 32;
+constexpr int defaultBlockSizeJ = 4;
+
+std::string makeLoopImpl(int lowerExtent, int upperExtent, const std::string& dim,
+                         const std::string& lower, const std::string& upper,
+                         const std::string& comparison, const std::string& increment) {
+  return "for(int " + dim + " = " + lower + "+" + std::to_string(lowerExtent) + "; " + dim + " " +
+         comparison + " " + upper + "+" + std::to_string(upperExtent) + "; " + increment + dim +
+         ")";
+}
+
+std::string makeTileLoop(const std::string& dim,
+                         const std::pair<std::string, std::string>& bounds) {
+  return "for(int " + dim + " = " + bounds.first + "; " + dim + " <= " + bounds.second + "; ++" +
+         dim + ")";
+}
+
+std::string makeIntervalBoundReadable(std::string dim, const iir::Interval& interval,
+                                      iir::Interval::Bound bound) {
+  if(interval.levelIsEnd(bound)) {
+    return dim + "Max + " + std::to_string(interval.offset(bound));
+  }
+  auto notEnd = interval.level(bound);
+  if(notEnd == 0) {
+    return dim + "Min + " + std::to_string(interval.offset(bound));
+  }
+  return dim + "Min + " + std::to_string(notEnd + interval.offset(bound));
+}
+
+std::string makeKLoop(bool isBackward, iir::Interval const& interval) {
+
+  const std::string lower = makeIntervalBoundReadable("k", interval, iir::Interval::Bound::lower);
+  const std::string upper = makeIntervalBoundReadable("k", interval, iir::Interval::Bound::upper);
+
+  return isBackward ? makeLoopImpl(0, 0, "k", upper, lower, ">=", "--")
+                    : makeLoopImpl(0, 0, "k", lower, upper, "<=", "++");
+}
+
+/// A stage can share the loops of the previous stages if none of them computes on a horizontal halo
+/// and none of them reads a field written by the stage at a horizontal offset
+bool canFuse(const std::vector<const iir::Stage*>& stages, const iir::Stage& stage) {
+  auto isPointwise = [](const iir::Stage& s) {
+    return s.getExtents().isHorizontalPointwise() && !s.hasIterationSpace();
+  };
+  if(!isPointwise(stage) || !std::all_of(stages.begin(), stages.end(),
+                                         [&](const iir::Stage* s) { return isPointwise(*s); }))
+    return false;
+
+  for(const auto& fieldPair : stage.getFields()) {
+    if(fieldPair.second.getIntend() == iir::Field::IntendKind::Input)
+      continue;
+    for(const iir::Stage* previous : stages) {
+      auto fieldIt = previous->getFields().find(fieldPair.first);
+      if(fieldIt != previous->getFields().end() && fieldIt->second.getReadExtents() &&
+         !fieldIt->second.getReadExtents()->isHorizontalPointwise())
+        return false;
+    }
+  }
+  return true;
+}
+
+/// Stencil temporaries which are only accessed within one multistage and without vertical offsets
+/// are never read across tiles, they can live in buffers of the tile. Fields passed to stencil
+/// functions and fields accessed in stages with an iteration space have to remain data views.
+bool isTileLocal(const iir::Stencil& stencil, int accessID) {
+  const auto& metadata = stencil.getMetadata();
+  if(!metadata.getStencilFunctionInstantiations().empty() ||
+     !metadata.isAccessType(iir::FieldAccessType::StencilTemporary, accessID))
+    return false;
+
+  const iir::MultiStage* accessingMultiStage = nullptr;
+  for(const auto& multiStagePtr : stencil.getChildren()) {
+    auto fieldIt = multiStagePtr->getFields().find(accessID);
+    if(fieldIt == multiStagePtr->getFields().end())
+      continue;
+    if(accessingMultiStage)
+      return false;
+    accessingMultiStage = multiStagePtr.get();
+
+    const iir::Extent& verticalExtent = fieldIt->second.getExtents().verticalExtent();
+    if(verticalExtent.minus() != 0 || verticalExtent.plus() != 0)
+      return false;
+  }
+  return accessingMultiStage &&
+         std::none_of(accessingMultiStage->childrenBegin(), accessingMultiStage->childrenEnd(),
+                      [&](const std::unique_ptr<iir::Stage>& stage) {
+                        return stage->hasIterationSpace() && stage->getFields().count(accessID);
+                      });
+}
+} // namespace
+
+CXXOptCodeGen::CXXOptCodeGen(const stencilInstantiationContext& ctx, DiagnosticsEngine& engine,
+                             int maxHaloPoint)
+    : CXXNaiveCodeGen(ctx, engine, maxHaloPoint) {}
+
+CXXOptCodeGen::~CXXOptCodeGen() {}
+
+std::set<int> CXXOptCodeGen::getScratchTemporaries(const iir::Stencil& stencil) const {
+  std::set<int> scratchTemporaries;
+  for(const auto& fieldPair : stencil.getFields())
+    if(isTileLocal(stencil, fieldPair.first))
+      scratchTemporaries.insert(fieldPair.first);
+  return scratchTemporaries;
+}
+
+void CXXOptCodeGen::generateMultiStage(
+    MemberFunction& stencilRunMethod,
+    const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
+    const iir::MultiStage& multiStage) const {
+
+  const auto& metadata = stencilInstantiation->getMetaData();
+  const auto& blockSize = stencilInstantiation->getIIR()->getBlockSize();
+  const int iBlockSize = blockSize[0] != 0 ? blockSize[0] : defaultBlockSizeI;
+  const int jBlockSize = blockSize[1] != 0 ? blockSize[1] : defaultBlockSizeJ;
+
+  // Local caches are never filled from nor flushed to the storages, their fields can therefore live
+  // in buffers of the tile like the tile-local temporaries. Number of vertical levels per buffer:
+  const iir::Stencil& stencil = *multiStage.getParent();
+  std::map<int, int> tileBufferSlots;
+  for(const auto& fieldPair : multiStage.getFields())
+    if(isTileLocal(stencil, fieldPair.first))
+      tileBufferSlots.emplace(fieldPair.first, 1);
+  if(metadata.getStencilFunctionInstantiations().empty()) {
+    for(const auto& cachePair : multiStage.getCaches()) {
+      const int accessID = cachePair.first;
+      const iir::Cache& cache = cachePair.second;
+      if(cache.getIOPolicy() != iir::Cache::IOPolicy::local ||
+         (cache.getType() != iir::Cache::CacheType::IJ &&
+          cache.getType() != iir::Cache::CacheType::K))
+        continue;
+      if(std::any_of(multiStage.childrenBegin(), multiStage.childrenEnd(),
+                     [&](const std::unique_ptr<iir::Stage>& stage) {
+                       return stage->hasIterationSpace() && stage->getFields().count(accessID);
+                     }))
+        continue;
+
+      int slots = 1;
+      if(cache.getType() == iir::Cache::CacheType::K) {
+        iir::Extent verticalExtent = multiStage.getKCacheVertExtent(accessID);
+        slots = verticalExtent.plus() - verticalExtent.minus() + 1;
+      }
+      tileBufferSlots[accessID] = slots;
+    }
+  }
+
+  // the buffers of a tile need to hold the redundant computations of all the stages and all the
+  // accesses to the buffered fields
+  iir::Extents msExtents(ast::cartesian);
+  for(const auto& stagePtr : multiStage.getChildren())
+    msExtents.merge(stagePtr->getExtents());
+  for(const auto& slotsPair : tileBufferSlots)
+    msExtents.merge(multiStage.getFields().at(slotsPair.first).getExtentsRB());
+  auto const& msHorizontalExtents =
+      iir::extent_cast<iir::CartesianExtent const&>(msExtents.horizontalExtent());
+  const int rowSize = iBlockSize + msHorizontalExtents.iPlus() - msHorizontalExtents.iMinus();
+  const int tileSize = rowSize * (jBlockSize + msHorizontalExtents.jPlus() -
+                                  msHorizontalExtents.jMinus());
+
+  std::map<int, TileCache> tileCaches;
+  for(const auto& slotsPair : tileBufferSlots)
+    tileCaches.emplace(slotsPair.first,
+                       TileCache{metadata.getFieldNameFromAccessID(slotsPair.first) + "_cache",
+                                 slotsPair.second, msHorizontalExtents.iMinus(),
+                                 msHorizontalExtents.jMinus(), rowSize});
+
+  // group consecutive stages sharing their loops
+  std::vector<std::vector<const iir::Stage*>> stageGroups;
+  for(const auto& stagePtr : multiStage.getChildren()) {
+    if(stageGroups.empty() || !canFuse(stageGroups.back(), *stagePtr))
+      stageGroups.emplace_back();
+    stageGroups.back().push_back(stagePtr.get());
+  }
+
+  ASTStencilBody stencilBodyCXXVisitor(metadata, tileCaches);
+
+  auto intervals_set = multiStage.getIntervals();
+  std::vector<iir::Interval> intervals_v;
+  std::copy(intervals_set.begin(), intervals_set.end(), std::back_inserter(intervals_v));
+
+  // compute the partition of the intervals
+  auto partitionIntervals = iir::Interval::computePartition(intervals_v);
+  if((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward))
+    std::reverse(partitionIntervals.begin(), partitionIntervals.end());
+
+  auto generateInterval = [&](const iir::Interval& interval) {
+    for(const auto& stageGroup : stageGroups) {
+      // stages of the group with a do-method in the interval
+      std::vector<const iir::Stage*> stages;
+      std::copy_if(stageGroup.begin(), stageGroup.end(), std::back_inserter(stages),
+                   [&](const iir::Stage* stage) {
+                     return std::any_of(stage->childrenBegin(), stage->childrenEnd(),
+                                        [&](const std::unique_ptr<iir::DoMethod>& doMethod) {
+                                          return doMethod->getInterval().overlaps(interval);
+                                        });
+                   });
+      if(stages.empty())
+        continue;
+
+      auto const& extents = iir::extent_cast<iir::CartesianExtent const&>(
+          stages.front()->getExtents().horizontalExtent());
+
+      auto generateStages = [&]() {
+        for(const iir::Stage* stage : stages) {
+          auto doMethodGenerator = [&]() {
+            for(const auto& doMethodPtr : stage->getChildren()) {
+              const iir::DoMethod& doMethod = *doMethodPtr;
+              if(!doMethod.getInterval().overlaps(interval))
+                continue;
+              for(const auto& stmt : doMethod.getAST().getStatements()) {
+                stmt->accept(stencilBodyCXXVisitor);
+                stencilRunMethod << stencilBodyCXXVisitor.getCodeAndResetStream();
+              }
+            }
+          };
+
+          if(stages.size() > 1) {
+            // fused stages may declare the same local variables
+            stencilRunMethod.ss() << "{\n";
+            doMethodGenerator();
+            stencilRunMethod.ss() << "}\n";
+          } else {
+            doMethodGenerator();
+          }
+        }
+      };
+
+      // stages with an iteration space are never fused, their loops are clipped to it
+      auto makeBounds = [&](const std::string& dim, int lowerExtent, int upperExtent) {
+        return makeIterationSpaceBounds(*stages.front(), dim,
+                                        dim + "b+" + std::to_string(lowerExtent),
+                                        dim + "e+" + std::to_string(upperExtent));
+      };
+      stencilRunMethod.addBlockStatement(
+          makeTileLoop("j", makeBounds("j", extents.jMinus(), extents.jPlus())), [&]() {
+            stencilRunMethod.ss() << "#pragma omp simd\n";
+            stencilRunMethod.addBlockStatement(
+                makeTileLoop("i", makeBounds("i", extents.iMinus(), extents.iPlus())),
+                generateStages);
+          });
+    }
+  };
+
+  // the buffers are reused by all tiles
+  for(const auto& cachePair : tileCaches) {
+    const TileCache& cache = cachePair.second;
+    stencilRunMethod.addStatement("::dawn::float_type " + cache.Name + "[" +
+                                  std::to_string(cache.Slots) + "][" + std::to_string(tileSize) +
+                                  "]");
+  }
+
+  stencilRunMethod.addBlockStatement(
+      "for(int ib = iMin; ib <= iMax; ib += " + std::to_string(iBlockSize) + ")", [&]() {
+        stencilRunMethod.addBlockStatement(
+            "for(int jb = jMin; jb <= jMax; jb += " + std::to_string(jBlockSize) + ")", [&]() {
+              const std::string iLast = "ib + " + std::to_string(iBlockSize - 1);
+              const std::string jLast = "jb + " + std::to_string(jBlockSize - 1);
+              stencilRunMethod.addStatement("const int ie = " + iLast + " < iMax ? " + iLast +
+                                            " : iMax");
+              stencilRunMethod.addStatement("const int je = " + jLast + " < jMax ? " + jLast +
+                                            " : jMax");
+              for(auto interval : partitionIntervals) {
+                stencilRunMethod.addBlockStatement(
+                    makeKLoop((multiStage.getLoopOrder() == iir::LoopOrderKind::Backward),
+                              interval),
+                    [&]() { generateInterval(interval); });
+              }
+            });
+      });
+}
+
+} // namespace cxxopt
+} // namespace codegen
+} // namespace dawn
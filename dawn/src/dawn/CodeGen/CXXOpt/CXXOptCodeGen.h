@@ -0,0 +1,55 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#ifndef DAWN_CODEGEN_CXXOPT_CXXOPTCODEGEN_H
+#define DAWN_CODEGEN_CXXOPT_CXXOPTCODEGEN_H
+
+#include "dawn/CodeGen/CXXNaive/CXXNaiveCodeGen.h"
+
+namespace dawn {
+namespace codegen {
+namespace cxxopt {
+
+/// @brief Optimized C++ code generation for the gtclang DSL
+///
+/// Shares the stencil wrapper and the stencil classes with the naive C++ backend, but generates
+/// the multistages as loop nests over i/j tiles (of the block size set by `PassSetBlockSize`). All
+/// stages of a multistage are computed tile by tile, consecutive stages without horizontal
+/// dependencies share their loops, and fields with local IJ- or K-caches (see `PassSetCaches`) are
+/// kept in buffers of the tile instead of the temporary storages. Stencil temporaries accessed
+/// within a single multistage (and at the current level only) are kept in such buffers as well, no
+/// full-domain storage is allocated for them.
+/// @ingroup cxxopt
+class CXXOptCodeGen : public cxxnaive::CXXNaiveCodeGen {
+public:
+  ///@brief constructor
+  CXXOptCodeGen(const stencilInstantiationContext& ctx, DiagnosticsEngine& engine,
+                int maxHaloPoint);
+  virtual ~CXXOptCodeGen();
+
+protected:
+  virtual std::string getBackendName() const override { return "cxxopt"; }
+
+  virtual void
+  generateMultiStage(MemberFunction& stencilRunMethod,
+                     const std::shared_ptr<iir::StencilInstantiation> stencilInstantiation,
+                     const iir::MultiStage& multiStage) const override;
+
+  virtual std::set<int> getScratchTemporaries(const iir::Stencil& stencil) const override;
+};
+} // namespace cxxopt
+} // namespace codegen
+} // namespace dawn
+
+#endif
@@ -1,5 +1,6 @@
 #include "dawn/CodeGen/CodeGen.h"
 #include "dawn/CodeGen/StencilFunctionAsBCGenerator.h"
+#include "dawn/CodeGen/TemporaryStoragePlan.h"
 #include "dawn/IIR/Extents.h"
 #include <optional>
 
@@ -255,8 +256,9 @@ CodeGen::computeCodeGenProperties(const iir::StencilInstantiation* stencilInstan
       codeGenProperties.setParamBC(field);
     }
   }
-  for(int accessID : metadata.getAccessesOfType<iir::FieldAccessType::InterStencilTemporary>()) {
-    codeGenProperties.insertAllocateField(metadata.getFieldNameFromAccessID(accessID));
+  for(const auto& storagePair : planInterStencilTemporaryStorages(*stencilInstantiation)) {
+    codeGenProperties.insertAllocateField(metadata.getFieldNameFromAccessID(storagePair.first),
+                                          metadata.getFieldNameFromAccessID(storagePair.second));
   }
 
   return codeGenProperties;
@@ -286,6 +288,90 @@ void CodeGen::generateStencilWrapperSyncMethod(Class& stencilWrapperClass) const
   syncStoragesMethod.commit();
 }
 
+std::string CodeGen::getTimerName(const iir::MultiStage& multiStage) {
+  return "m_ms" + std::to_string(multiStage.getID()) + "_timer";
+}
+
+std::string CodeGen::getTimerName(const iir::Stage& stage) {
+  return "m_stage" + std::to_string(stage.getStageID()) + "_timer";
+}
+
+void CodeGen::addTimers(Structure& stencilClass, const iir::Stencil& stencil) const {
+  std::vector<std::pair<int, std::string>> multiStageTimers, stageTimers;
+  for(const auto& multiStage : stencil.getChildren()) {
+    multiStageTimers.emplace_back(multiStage->getID(), getTimerName(*multiStage));
+    for(const auto& stage : multiStage->getChildren())
+      stageTimers.emplace_back(stage->getStageID(), getTimerName(*stage));
+  }
+
+  // the timers are labeled by their names without the `m_` prefix and `_timer` suffix
+  stencilClass.addComment("Timers of the multistages and stages");
+  for(const auto& timers : {multiStageTimers, stageTimers})
+    for(const auto& [id, name] : timers) {
+      const std::string label = name.substr(2, name.rfind("_timer") - 2);
+      stencilClass.addMember(timerTypename_, name + "{\"" + label + "\"}");
+    }
+
+  stencilClass.addMemberFunction("double", "get_time")
+      .isConst(true)
+      .addStatement("return total_time()");
+
+  MemberFunction resetMeters = stencilClass.addMemberFunction("void", "reset_meters");
+  resetMeters.startBody();
+  resetMeters.addStatement("reset()");
+  for(const auto& timers : {multiStageTimers, stageTimers})
+    for(const auto& [id, name] : timers)
+      resetMeters.addStatement(name + ".reset()");
+  resetMeters.commit();
+
+  auto addTimes = [&](const std::string& methodName,
+                      const std::vector<std::pair<int, std::string>>& timers) {
+    stencilClass.addMemberFunction("std::map<int, double>", methodName)
+        .isConst(true)
+        .addStatement("return {" +
+                      RangeToString(", ", "", "")(timers,
+                                                  [](const std::pair<int, std::string>& timer) {
+                                                    return "{" + std::to_string(timer.first) +
+                                                           ", " + timer.second + ".total_time()}";
+                                                  }) +
+                      "}");
+  };
+  addTimes("get_multistage_times", multiStageTimers);
+  addTimes("get_stage_times", stageTimers);
+}
+
+void CodeGen::generateTimersAPI(Class& stencilWrapperClass,
+                                const std::vector<std::string>& stencilMembers) const {
+  MemberFunction resetMeters = stencilWrapperClass.addMemberFunction("void", "reset_meters");
+  resetMeters.startBody();
+  for(const auto& member : stencilMembers)
+    resetMeters.addStatement(member + ".reset_meters()");
+  resetMeters.commit();
+
+  MemberFunction totalTime = stencilWrapperClass.addMemberFunction("double", "get_total_time");
+  totalTime.isConst(true);
+  totalTime.startBody();
+  totalTime.addStatement("double res = 0");
+  for(const auto& member : stencilMembers)
+    totalTime.addStatement("res += " + member + ".get_time()");
+  totalTime.addStatement("return res");
+  totalTime.commit();
+
+  // the IDs of the multistages and stages are unique across all stencils
+  for(const std::string methodName : {"get_multistage_times", "get_stage_times"}) {
+    MemberFunction times =
+        stencilWrapperClass.addMemberFunction("std::map<int, double>", methodName);
+    times.isConst(true);
+    times.startBody();
+    times.addStatement("std::map<int, double> res");
+    for(const auto& member : stencilMembers)
+      times.addStatement("for(const auto& time : " + member + "." + methodName +
+                         "()) res.insert(time)");
+    times.addStatement("return res");
+    times.commit();
+  }
+}
+
 std::string CodeGen::getStorageType(const sir::FieldDimensions& dimensions) {
   DAWN_ASSERT_MSG(
       sir::dimension_isa<sir::CartesianFieldDimension>(dimensions.getHorizontalFieldDimension()),
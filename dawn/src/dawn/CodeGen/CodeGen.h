@@ -71,6 +71,22 @@ protected:
                            IndexRange<const std::map<int, iir::Stencil::FieldInfo>>& nonTempFields,
                            ast::GridType const& gridType) const;
 
+  /// @brief Add a timer for each multistage and stage of `stencil` to its class, which has to
+  /// derive from `timerTypename_` to time the whole stencil. Adds `get_time`, `reset_meters` and
+  /// the break down of the time by `get_multistage_times` and `get_stage_times`, which map the IDs
+  /// of the multistages (stages) to their accumulated time in seconds.
+  void addTimers(Structure& stencilClass, const iir::Stencil& stencil) const;
+
+  /// @brief Add `reset_meters`, `get_total_time`, `get_multistage_times` and `get_stage_times`
+  /// over all stencil members to the wrapper class (see `addTimers`)
+  void generateTimersAPI(Class& stencilWrapperClass,
+                         const std::vector<std::string>& stencilMembers) const;
+
+  /// @brief Name of the member of the stencil class timing the multistage (stage)
+  static std::string getTimerName(const iir::MultiStage& multiStage);
+  static std::string getTimerName(const iir::Stage& stage);
+
+  const std::string timerTypename_ = "gridtools::dawn::timer_x86";
   const std::string tmpStorageTypename_ = "tmp_storage_t";
   const std::string tmpMetadataTypename_ = "tmp_meta_data_t";
   const std::string tmpMetadataName_ = "m_tmp_meta_data";
@@ -70,11 +70,31 @@ CodeGenProperties::getParameterNameToType() const {
   return paramNameToType_;
 }
 
-void CodeGenProperties::insertAllocateField(std::string name) { allocatedFields_.insert(name); }
+void CodeGenProperties::insertAllocateField(std::string name, std::string storageName) {
+  allocatedFieldToStorage_.emplace(name, storageName);
+}
+
+bool CodeGenProperties::hasAllocatedFields() const { return !allocatedFieldToStorage_.empty(); }
+
+std::set<std::string> CodeGenProperties::getAllocatedFields() const {
+  std::set<std::string> fields;
+  for(const auto& fieldStoragePair : allocatedFieldToStorage_)
+    fields.insert(fieldStoragePair.first);
+  return fields;
+}
 
-bool CodeGenProperties::hasAllocatedFields() const { return !allocatedFields_.empty(); }
+std::set<std::string> CodeGenProperties::getAllocatedStorages() const {
+  std::set<std::string> storages;
+  for(const auto& fieldStoragePair : allocatedFieldToStorage_)
+    storages.insert(fieldStoragePair.second);
+  return storages;
+}
 
-std::set<std::string> CodeGenProperties::getAllocatedFields() const { return allocatedFields_; }
+const std::string& CodeGenProperties::getAllocatedStorage(const std::string& name) const {
+  DAWN_ASSERT_MSG(allocatedFieldToStorage_.count(name),
+                  std::string("allocated field " + name + " not found").c_str());
+  return allocatedFieldToStorage_.at(name);
+}
 
 std::shared_ptr<StencilProperties>
 CodeGenProperties::insertStencil(StencilContext context, const int id, const std::string name) {
@@ -18,6 +18,7 @@
 #include "dawn/IIR/Stencil.h"
 #include "dawn/IIR/StencilInstantiation.h"
 #include "dawn/Support/Assert.h"
+#include <map>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -53,8 +54,8 @@ class CodeGenProperties {
   // map of parameter position to its name
   std::unordered_map<size_t, std::string> paramPositionIdxToName_;
 
-  // set of fields allocate by the stencil wrapper
-  std::set<std::string> allocatedFields_;
+  // map of the fields allocated by the stencil wrapper to the name of their storage
+  std::map<std::string, std::string> allocatedFieldToStorage_;
 
   // array stencil properties. The elements of the array corresponds to
   // SC_Stencil and SC_StencilFunction
@@ -71,12 +72,19 @@ public:
   /// @brief insert a parameter in the mapping data structures
   void insertParam(const size_t paramPosition, std::string paramName, std::string paramType);
 
-  /// @brief insert the name of an allocated field
-  void insertAllocateField(std::string name);
+  /// @brief insert the name of an allocated field and of the storage holding it (fields with
+  /// disjoint lifetimes may share a storage)
+  void insertAllocateField(std::string name, std::string storageName);
 
   /// @brief get the set of allocated fields
   std::set<std::string> getAllocatedFields() const;
 
+  /// @brief get the set of storages holding the allocated fields
+  std::set<std::string> getAllocatedStorages() const;
+
+  /// @brief get the name of the storage holding the allocated field
+  const std::string& getAllocatedStorage(const std::string& name) const;
+
   /// @brief true if stencil has allocated fields
   bool hasAllocatedFields() const;
 
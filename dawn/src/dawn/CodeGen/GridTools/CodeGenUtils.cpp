@@ -23,7 +23,8 @@ namespace gt {
 std::vector<std::string>
 CodeGenUtils::buildPlaceholderList(const iir::StencilMetaInformation& metadata,
                                    const std::map<int, iir::Stencil::FieldInfo>& stencilFields,
-                                   const sir::GlobalVariableMap& globalsMap, bool buildPair) {
+                                   const sir::GlobalVariableMap& globalsMap,
+                                   const CodeGenProperties& codeGenProperties, bool buildPair) {
   auto nonTempFields =
       makeRange(stencilFields, [](std::pair<int, iir::Stencil::FieldInfo> const& p) {
         return !p.second.IsTemporary;
@@ -42,7 +43,7 @@ CodeGenUtils::buildPlaceholderList(const iir::StencilMetaInformation& metadata,
       // to
       // metadata.isInterStencilTemporary(fieldInfoPair.first)
       if(metadata.isAccessType(iir::FieldAccessType::InterStencilTemporary, fieldInfoPair.first)) {
-        placeholderStatement << "m_" << fieldName;
+        placeholderStatement << "m_" << codeGenProperties.getAllocatedStorage(fieldName);
       } else {
         placeholderStatement << fieldName;
       }
@@ -15,6 +15,7 @@
 #ifndef DAWN_CODEGEN_GRIDTOOLS_CODEGENUTILS_H
 #define DAWN_CODEGEN_GRIDTOOLS_CODEGENUTILS_H
 
+#include "dawn/CodeGen/CodeGenProperties.h"
 #include "dawn/IIR/Stencil.h"
 #include <map>
 #include <string>
@@ -25,11 +26,13 @@ namespace codegen {
 namespace gt {
 
 struct CodeGenUtils {
-  // build the collection of placeholder typedef names
+  // build the collection of placeholder typedef names, with `buildPair` assigning each the field
+  // or the wrapper storage (see CodeGenProperties::getAllocatedStorage) it is bound to
   static std::vector<std::string>
   buildPlaceholderList(const iir::StencilMetaInformation& metadata,
                        const std::map<int, iir::Stencil::FieldInfo>& stencilFields,
-                       const sir::GlobalVariableMap& globalsMap, bool buildPair = false);
+                       const sir::GlobalVariableMap& globalsMap,
+                       const CodeGenProperties& codeGenProperties, bool buildPair = false);
 };
 
 } // namespace gt
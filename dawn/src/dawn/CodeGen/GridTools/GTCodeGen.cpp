@@ -305,7 +305,7 @@ void GTCodeGen::generateStencilWrapperRun(
         RangeToString(", ", "", "")(nonTempFields, [&](const iir::Stencil::FieldInfo& fieldInfo) {
           if(metadata.isAccessType(iir::FieldAccessType::InterStencilTemporary,
                                    fieldInfo.field.getAccessID()))
-            return "m_" + fieldInfo.Name;
+            return "m_" + codeGenProperties.getAllocatedStorage(fieldInfo.Name);
           else
             return fieldInfo.Name;
         });
@@ -348,7 +348,6 @@ void GTCodeGen::generateStencilWrapperCtr(
     const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation,
     CodeGenProperties& codeGenProperties) const {
 
-  const auto& metadata = stencilInstantiation->getMetaData();
   const auto& stencils = stencilInstantiation->getStencils();
   const auto& globalsMap = stencilInstantiation->getIIR()->getGlobalVariableMap();
 
@@ -360,12 +359,10 @@ void GTCodeGen::generateStencilWrapperCtr(
   StencilWrapperConstructor.addArg("const " + c_dgt() + "domain& dom");
 
   // Initialize allocated fields
-  if(metadata.hasAccessesOfType<iir::FieldAccessType::InterStencilTemporary>()) {
-    std::vector<std::string> tempFields;
-    for(auto accessID : metadata.getAccessesOfType<iir::FieldAccessType::InterStencilTemporary>()) {
-      tempFields.push_back(metadata.getFieldNameFromAccessID(accessID));
-    }
-    addTmpStorageInitStencilWrapperCtr(StencilWrapperConstructor, stencils, tempFields);
+  if(codeGenProperties.hasAllocatedFields()) {
+    const std::set<std::string> storages = codeGenProperties.getAllocatedStorages();
+    addTmpStorageInitStencilWrapperCtr(StencilWrapperConstructor, stencils,
+                                       std::vector<std::string>(storages.begin(), storages.end()));
   }
   StencilWrapperConstructor.addInit("m_dom(dom)");
 
@@ -413,9 +410,9 @@ void GTCodeGen::generateStencilWrapperMembers(
     stencilWrapperClass.addMember(c_dgt() + "meta_data_t", "m_meta_data");
   }
 
-  // Define allocated memebers if necessary
-  for(const auto& fieldName : codeGenProperties.getAllocatedFields()) {
-    stencilWrapperClass.addMember(c_dgt() + "storage_t", "m_" + fieldName);
+  // Define allocated memebers if necessary, fields with disjoint lifetimes share their storages
+  for(const auto& storageName : codeGenProperties.getAllocatedStorages()) {
+    stencilWrapperClass.addMember(c_dgt() + "storage_t", "m_" + storageName);
   }
 
   // Stencil members
@@ -936,7 +933,7 @@ void GTCodeGen::generateStencilClasses(
     stencilClass.addComment("Members");
 
     auto plchdrs = CodeGenUtils::buildPlaceholderList(stencilInstantiation->getMetaData(),
-                                                      stencilFields, globalsMap);
+                                                      stencilFields, globalsMap, codeGenProperties);
 
     stencilType = c_gt().str() + "computation" + RangeToString(",", "<", ">")(plchdrs);
 
@@ -0,0 +1,106 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/CodeGen/TemporaryStoragePlan.h"
+#include "dawn/IIR/ASTVisitor.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include <algorithm>
+#include <numeric>
+
+namespace dawn {
+namespace codegen {
+
+namespace {
+
+/// Collects the IDs of the stencils called within a statement of the control flow
+class StencilCallCollector : public iir::ASTVisitorForwarding {
+  const iir::StencilMetaInformation& metadata_;
+  std::vector<int>& stencilIDs_;
+
+public:
+  StencilCallCollector(const iir::StencilMetaInformation& metadata, std::vector<int>& stencilIDs)
+      : metadata_(metadata), stencilIDs_(stencilIDs) {}
+
+  void visit(const std::shared_ptr<iir::StencilCallDeclStmt>& stmt) override {
+    stencilIDs_.push_back(metadata_.getStencilIDFromStencilCallStmt(stmt));
+  }
+};
+
+} // namespace
+
+std::vector<int> assignStorages(const std::vector<std::pair<int, int>>& liveRanges) {
+  std::vector<std::size_t> order(liveRanges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+    return liveRanges[lhs].first < liveRanges[rhs].first;
+  });
+
+  std::vector<int> storages(liveRanges.size());
+  std::vector<int> storageEnds; // last element of the latest interval of each storage
+  for(std::size_t idx : order) {
+    auto freeIt =
+        std::find_if(storageEnds.begin(), storageEnds.end(),
+                     [&](int storageEnd) { return storageEnd < liveRanges[idx].first; });
+    if(freeIt == storageEnds.end())
+      freeIt = storageEnds.insert(storageEnds.end(), 0);
+    *freeIt = liveRanges[idx].second;
+    storages[idx] = freeIt - storageEnds.begin();
+  }
+  return storages;
+}
+
+std::map<int, int>
+planInterStencilTemporaryStorages(const iir::StencilInstantiation& instantiation) {
+  const auto& metadata = instantiation.getMetaData();
+  const auto& statements = instantiation.getIIR()->getControlFlowDescriptor().getStatements();
+
+  std::vector<int> accessIDs;
+  for(int accessID : metadata.getAccessesOfType<iir::FieldAccessType::InterStencilTemporary>())
+    accessIDs.push_back(accessID);
+  std::sort(accessIDs.begin(), accessIDs.end());
+
+  // temporaries which are not accessed by any stencil call are kept alive all the time
+  std::vector<std::pair<int, int>> liveRanges(
+      accessIDs.size(), std::make_pair(int(statements.size()), -1));
+  for(int stmtIdx = 0; stmtIdx < int(statements.size()); ++stmtIdx) {
+    std::vector<int> stencilIDs;
+    StencilCallCollector collector(metadata, stencilIDs);
+    statements[stmtIdx]->accept(collector);
+
+    for(int stencilID : stencilIDs) {
+      const auto& fields = instantiation.getIIR()->getStencil(stencilID).getFields();
+      for(std::size_t idx = 0; idx < accessIDs.size(); ++idx) {
+        if(!fields.count(accessIDs[idx]))
+          continue;
+        liveRanges[idx].first = std::min(liveRanges[idx].first, stmtIdx);
+        liveRanges[idx].second = std::max(liveRanges[idx].second, stmtIdx);
+      }
+    }
+  }
+  for(auto& liveRange : liveRanges)
+    if(liveRange.second < 0)
+      liveRange = std::make_pair(0, int(statements.size()));
+
+  const std::vector<int> storages = assignStorages(liveRanges);
+  std::map<int, int> storageOwners;
+  std::map<int, int> plan;
+  for(std::size_t idx = 0; idx < accessIDs.size(); ++idx)
+    storageOwners.emplace(storages[idx], accessIDs[idx]);
+  for(std::size_t idx = 0; idx < accessIDs.size(); ++idx)
+    plan.emplace(accessIDs[idx], storageOwners.at(storages[idx]));
+  return plan;
+}
+
+} // namespace codegen
+} // namespace dawn
@@ -0,0 +1,54 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#ifndef DAWN_CODEGEN_TEMPORARYSTORAGEPLAN_H
+#define DAWN_CODEGEN_TEMPORARYSTORAGEPLAN_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace dawn {
+namespace iir {
+class StencilInstantiation;
+}
+
+namespace codegen {
+
+/// @brief Assign intervals `[first, last]` to a minimal number of storages such that the intervals
+/// of a storage are disjoint
+///
+/// The intervals are processed in the order of their first element and each is assigned to the
+/// free storage with the lowest index, which is optimal for interval graphs.
+///
+/// @returns the storage index of each interval
+/// @ingroup codegen
+std::vector<int> assignStorages(const std::vector<std::pair<int, int>>& liveRanges);
+
+/// @brief Plan the storages allocated by the stencil wrapper for the inter-stencil temporaries
+///
+/// The live range of a temporary spans the statements of the control flow from the first to the
+/// last one calling a stencil which accesses the temporary (all stencil calls nested in one
+/// statement share its position). Temporaries with disjoint live ranges share a storage.
+///
+/// @returns the AccessID of the temporary whose storage holds each inter-stencil temporary (the
+/// temporary with the lowest AccessID of each storage keeps its own one)
+/// @ingroup codegen
+std::map<int, int>
+planInterStencilTemporaryStorages(const iir::StencilInstantiation& instantiation);
+
+} // namespace codegen
+} // namespace dawn
+
+#endif
@@ -0,0 +1,242 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/Compiler/CompilationCache.h"
+#include "dawn/Compiler/DawnCompiler.h"
+#include "dawn/SIR/SIR.h"
+#include "dawn/Serialization/SIRSerializer.h"
+#include "dawn/Support/Config.h"
+#include "dawn/Support/FileSystem.h"
+#include "dawn/Support/Format.h"
+#include "dawn/Support/Json.h"
+#include "dawn/Support/Logging.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace dawn {
+
+namespace {
+
+const char* EntryExtension = ".tu.json";
+
+/// @brief 64-bit FNV-1a hash, which unlike `std::hash` is the same for every build of dawn
+std::string hashFNV1a(const std::string& data) {
+  std::uint64_t hash = 14695981039346656037ull;
+  for(unsigned char c : data) {
+    hash ^= c;
+    hash *= 1099511628211ull;
+  }
+  return format("%016llx", (unsigned long long)hash);
+}
+
+std::string readFile(const std::string& filename) {
+  std::ifstream ifs(filename, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+}
+
+/// @brief Remove the IDs of the AST nodes, which depend on the number of nodes created before the
+/// SIR in the same process
+void removeIDs(json::json& node) {
+  if(node.is_object()) {
+    node.erase("ID");
+    for(auto& child : node)
+      removeIDs(child);
+  } else if(node.is_array()) {
+    for(auto& child : node)
+      removeIDs(child);
+  }
+}
+
+/// @brief Whether the option `name` has effects besides the generated code, i.e it prints to the
+/// console or writes files
+bool isSideEffectOption(const std::string& name) {
+  for(const char* prefix : {"Dump", "Print", "Report"})
+    if(name.compare(0, std::strlen(prefix), prefix) == 0)
+      return true;
+  return name == "SerializeIIR" || name == "PassVerbose" || name == "PassTiming" ||
+         name == "PassTimingTrace";
+}
+
+bool isEnabled(bool value) { return value; }
+bool isEnabled(const std::string& value) { return !value.empty(); }
+
+} // anonymous namespace
+
+CompilationCache::CompilationCache(const std::string& directory, std::uintmax_t maxSize)
+    : directory_(directory), maxSize_(maxSize) {
+  std::error_code ec;
+  fs::create_directories(directory_, ec);
+  if(ec)
+    DAWN_LOG(WARNING) << "cannot create compilation cache \"" << directory_
+                      << "\": " << ec.message();
+}
+
+std::string CompilationCache::computeInput(const SIR& sir, const Options& options,
+                                           const std::list<PassGroup>& groups) {
+  json::json input;
+  // Entries of a different build of dawn (which may generate different code) are never hit
+  input["version"] = DAWN_FULL_VERSION_STR;
+
+  json::json sirJson =
+      json::json::parse(SIRSerializer::serializeToString(&sir, SIRSerializer::Format::Json));
+  removeIDs(sirJson);
+  input["sir"] = sirJson;
+
+  Options keyOptions = options;
+  keyOptions.CacheDir = "";
+  keyOptions.CacheMaxSize = 0;
+  std::stringstream ss;
+#define OPT(TYPE, NAME, DEFAULT_VALUE, OPTION, OPTION_SHORT, HELP, VALUE_NAME, HAS_VALUE, F_GROUP) \
+  ss << #NAME " = " << keyOptions.NAME << "\n";
+#include "dawn/CodeGen/Options.inc"
+#include "dawn/Compiler/Options.inc"
+#include "dawn/Optimizer/Options.inc"
+#include "dawn/Optimizer/PassOptions.inc"
+#undef OPT
+  input["options"] = ss.str();
+
+  std::vector<int> groupIDs;
+  for(PassGroup group : groups)
+    groupIDs.push_back(static_cast<int>(group));
+  input["groups"] = groupIDs;
+
+  input["hardwareConfig"] =
+      options.HardwareConfigFile.empty() ? "" : readFile(options.HardwareConfigFile);
+  return input.dump();
+}
+
+std::string CompilationCache::computeKey(const std::string& input) { return hashFNV1a(input); }
+
+bool CompilationCache::isCacheable(const Options& options) {
+#define OPT(TYPE, NAME, DEFAULT_VALUE, OPTION, OPTION_SHORT, HELP, VALUE_NAME, HAS_VALUE, F_GROUP) \
+  if(isSideEffectOption(#NAME) && isEnabled(options.NAME))                                         \
+    return false;
+#include "dawn/CodeGen/Options.inc"
+#include "dawn/Compiler/Options.inc"
+#include "dawn/Optimizer/Options.inc"
+#include "dawn/Optimizer/PassOptions.inc"
+#undef OPT
+  return true;
+}
+
+std::string CompilationCache::getEntryPath(const std::string& key) const {
+  return (fs::path(directory_) / (key + EntryExtension)).string();
+}
+
+std::unique_ptr<codegen::TranslationUnit>
+CompilationCache::lookup(const std::string& key, const std::string& input) const {
+  const std::string path = getEntryPath(key);
+  std::ifstream ifs(path);
+  if(!ifs.is_open())
+    return nullptr;
+
+  try {
+    json::json entry;
+    ifs >> entry;
+    if(entry.at("input").get<std::string>() != input) {
+      DAWN_LOG(INFO) << "compilation cache entry \"" << path << "\" has a different input";
+      return nullptr;
+    }
+    auto translationUnit = std::make_unique<codegen::TranslationUnit>(
+        entry.at("filename").get<std::string>(),
+        entry.at("ppDefines").get<std::vector<std::string>>(),
+        entry.at("stencils").get<std::map<std::string, std::string>>(),
+        entry.at("globals").get<std::string>());
+
+    // Mark the entry as recently used
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return translationUnit;
+  } catch(const json::json::exception& e) {
+    DAWN_LOG(WARNING) << "ignoring corrupt compilation cache entry \"" << path
+                      << "\": " << e.what();
+    return nullptr;
+  }
+}
+
+void CompilationCache::insert(const std::string& key, const std::string& input,
+                              const codegen::TranslationUnit& translationUnit) const {
+  json::json entry;
+  entry["input"] = input;
+  entry["filename"] = translationUnit.getFilename();
+  entry["ppDefines"] = translationUnit.getPPDefines();
+  entry["stencils"] = translationUnit.getStencils();
+  entry["globals"] = translationUnit.getGlobals();
+
+  // Write to a file private to this compiler and publish it by renaming, which is atomic
+  const std::string path = getEntryPath(key);
+  const std::string tmpPath = path + format(".%08x.tmp", std::random_device()());
+  {
+    std::ofstream ofs(tmpPath);
+    if(!ofs.is_open()) {
+      DAWN_LOG(WARNING) << "cannot write compilation cache entry \"" << tmpPath << "\"";
+      return;
+    }
+    ofs << entry.dump();
+  }
+  std::error_code ec;
+  fs::rename(tmpPath, path, ec);
+  if(ec) {
+    DAWN_LOG(WARNING) << "cannot write compilation cache entry \"" << path
+                      << "\": " << ec.message();
+    fs::remove(tmpPath, ec);
+    return;
+  }
+
+  evict();
+}
+
+void CompilationCache::evict() const {
+  struct Entry {
+    fs::path Path;
+    fs::file_time_type LastUse;
+    std::uintmax_t Size;
+  };
+  std::vector<Entry> entries;
+  std::uintmax_t totalSize = 0;
+
+  std::error_code ec;
+  for(fs::directory_iterator it(directory_, ec), end; !ec && it != end; it.increment(ec)) {
+    const fs::path& path = it->path();
+    const std::string filename = path.filename().string();
+    if(filename.size() < std::strlen(EntryExtension) ||
+       filename.compare(filename.size() - std::strlen(EntryExtension), std::string::npos,
+                        EntryExtension) != 0)
+      continue;
+
+    std::error_code entryEc;
+    Entry entry{path, fs::last_write_time(path, entryEc), fs::file_size(path, entryEc)};
+    // The entry may have been evicted concurrently
+    if(entryEc)
+      continue;
+    totalSize += entry.Size;
+    entries.push_back(std::move(entry));
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.LastUse < b.LastUse; });
+  for(const Entry& entry : entries) {
+    if(totalSize <= maxSize_)
+      break;
+    fs::remove(entry.Path, ec);
+    totalSize -= entry.Size;
+  }
+}
+
+} // namespace dawn
@@ -0,0 +1,86 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#ifndef DAWN_COMPILER_COMPILATIONCACHE_H
+#define DAWN_COMPILER_COMPILATIONCACHE_H
+
+#include "dawn/CodeGen/TranslationUnit.h"
+#include "dawn/Compiler/Options.h"
+#include "dawn/Support/NonCopyable.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+
+namespace dawn {
+
+struct SIR;
+enum class PassGroup;
+
+/// @brief On-disk cache of translation units, addressed by the content of the compiler input
+///
+/// An entry is a JSON file named after the key of the compilation, i.e a hash of the serialized
+/// SIR, the options and the pass groups. The entry also stores this input, a hit requires it to be
+/// equal to the input of the compilation, hence colliding keys are misses. A hit refreshes the
+/// modification time of the entry, and inserting an entry evicts the least recently used entries
+/// until the total size of the entries fits into the size limit. Entries are written to a temporary
+/// file which is then renamed, hence concurrent compilers can share a cache directory.
+///
+/// Failing to read or write the cache is not an error, the compiler then simply does not use it.
+///
+/// @ingroup compiler
+class CompilationCache : NonCopyable {
+public:
+  /// @brief Cache in `directory` (created if it does not exist), holding at most `maxSize` bytes
+  CompilationCache(const std::string& directory, std::uintmax_t maxSize);
+
+  /// @brief Serialize the input of compiling `sir` with `options` and the pass `groups`
+  ///
+  /// The cache options themselves do not change the generated code and are not part of the input,
+  /// while the full version of dawn (including the git hash) and the content of the hardware
+  /// configuration file are.
+  static std::string computeInput(const SIR& sir, const Options& options,
+                                  const std::list<PassGroup>& groups);
+
+  /// @brief Compute the key of the compilation with the given `input`
+  static std::string computeKey(const std::string& input);
+
+  /// @brief Whether the compilation with `options` can be cached
+  ///
+  /// Compilations with side effects besides the generated code, i.e with any of the dump, print or
+  /// report options, pass verbosity, pass timing or IIR serialization enabled, are not cached as a
+  /// hit would skip those side effects.
+  static bool isCacheable(const Options& options);
+
+  /// @brief Get the translation unit of `key` or `nullptr` if there is none or if it was compiled
+  /// from a different `input`
+  std::unique_ptr<codegen::TranslationUnit> lookup(const std::string& key,
+                                                   const std::string& input) const;
+
+  /// @brief Store the translation unit of `key` compiled from `input` and evict entries exceeding
+  /// the size limit
+  void insert(const std::string& key, const std::string& input,
+              const codegen::TranslationUnit& translationUnit) const;
+
+private:
+  std::string getEntryPath(const std::string& key) const;
+  void evict() const;
+
+  std::string directory_;
+  std::uintmax_t maxSize_;
+};
+
+} // namespace dawn
+
+#endif
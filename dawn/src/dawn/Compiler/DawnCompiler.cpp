@@ -16,9 +16,11 @@
 #include "dawn/AST/GridType.h"
 #include "dawn/CodeGen/CXXNaive-ico/CXXNaiveCodeGen.h"
 #include "dawn/CodeGen/CXXNaive/CXXNaiveCodeGen.h"
+#include "dawn/CodeGen/CXXOpt/CXXOptCodeGen.h"
 #include "dawn/CodeGen/CodeGen.h"
 #include "dawn/CodeGen/Cuda/CudaCodeGen.h"
 #include "dawn/CodeGen/GridTools/GTCodeGen.h"
+#include "dawn/Compiler/CompilationCache.h"
 #include "dawn/Optimizer/OptimizerContext.h"
 #include "dawn/Optimizer/PassDataLocalityMetric.h"
 #include "dawn/Optimizer/PassFieldVersioning.h"
@@ -58,7 +60,14 @@
 #include "dawn/Support/Logging.h"
 #include "dawn/Support/StringSwitch.h"
 #include "dawn/Support/StringUtil.h"
+#include "dawn/Support/UIDGenerator.h"
 #include "dawn/Support/Unreachable.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <thread>
 
 namespace dawn {
 
@@ -76,6 +85,8 @@ BackendType parseBackendString(const std::string& backendStr) {
     return BackendType::CXXNaiveIco;
   } else if(backendStr == "cuda" || backendStr == "CUDA") {
     return BackendType::CUDA;
+  } else if(backendStr == "opt" || backendStr == "cxxopt" || backendStr == "c++-opt") {
+    return BackendType::CXXOpt;
   } else {
     throw CompileError("Backend not supported");
   }
@@ -144,11 +155,126 @@ DiagnosticsBuilder buildDiag(const std::string& option, const T& value, std::str
   }
   return diag;
 }
+
+/// @brief Number of identifiers reserved for the passes run on one stencil instantiation, an
+/// instantiation needing more continues with a further block (see `UIDGenerator::ScopedBlock`)
+constexpr int UIDBlockSize = 1 << 16;
+
+/// @brief Run the passes registered by `pushPasses` on all stencil instantiations of `optimizer`
+///
+/// With more than one thread (option `-optimizer-threads`), each instantiation is handled by a
+/// fresh copy of the pass pipeline in a context of its own, as passes keep state between runs.
+/// Every instantiation then draws its identifiers from a block reserved upfront in map order, and
+/// the unused tail of the blocks is given back once all threads are done. The diagnostics are
+/// merged in map order afterwards, hence the result does not depend on the thread schedule.
+void runPassPipeline(OptimizerContext& optimizer,
+                     const std::function<void(OptimizerContext&)>& pushPasses,
+                     const std::string& pipelineName) {
+  auto& stencilInstantiationMap = optimizer.getStencilInstantiationMap();
+  const auto& options = optimizer.getOptions();
+
+  int numThreads = options.OptimizerThreads > 0 ? options.OptimizerThreads
+                                                 : std::thread::hardware_concurrency();
+  numThreads = std::min<int>(numThreads, stencilInstantiationMap.size());
+  if(numThreads > 1 && options.PassVerbose) {
+    // The json dumps of the passes are numbered by a per-pipeline counter
+    DAWN_LOG(WARNING) << "Running the " << pipelineName << " passes sequentially in verbose mode";
+    numThreads = 1;
+  }
+
+  std::vector<std::shared_ptr<iir::StencilInstantiation>> instantiations;
+  for(auto& stencil : stencilInstantiationMap)
+    instantiations.push_back(stencil.second);
+
+  const std::size_t numInstantiations = instantiations.size();
+  if(numThreads <= 1) {
+    pushPasses(optimizer);
+    for(auto& instantiation : instantiations) {
+      DAWN_LOG(INFO) << "Starting " << pipelineName << " passes for `" << instantiation->getName()
+                     << "` ...";
+      if(!optimizer.getPassManager().runAllPassesOnStencilInstantiation(optimizer, instantiation))
+        throw std::runtime_error("An error occurred.");
+
+      DAWN_LOG(INFO) << "Done with " << pipelineName << " passes for `" << instantiation->getName()
+                     << "`";
+    }
+    return;
+  }
+
+  int firstUID;
+  try {
+    firstUID = UIDGenerator::getInstance()->reserve(numInstantiations * UIDBlockSize);
+  } catch(const std::runtime_error& e) {
+    DiagnosticsBuilder diag(DiagnosticsKind::Error);
+    diag << e.what();
+    optimizer.getDiagnostics().report(diag);
+    throw;
+  }
+  auto getUIDBlock = [&](std::size_t i) { return firstUID + int(i) * UIDBlockSize; };
+  // Identifier following the last one used by each instantiation
+  std::vector<int> nextUIDs(numInstantiations);
+
+  std::vector<std::unique_ptr<DiagnosticsEngine>> diagnostics(numInstantiations);
+  std::vector<char> succeeded(numInstantiations, false);
+  std::vector<std::exception_ptr> exceptions(numInstantiations);
+  std::atomic<std::size_t> next(0);
+
+  auto worker = [&]() {
+    for(std::size_t i = next++; i < numInstantiations; i = next++) {
+      auto& instantiation = instantiations[i];
+      UIDGenerator::ScopedBlock uidBlock(getUIDBlock(i), UIDBlockSize);
+
+      diagnostics[i] = std::make_unique<DiagnosticsEngine>();
+      diagnostics[i]->setFilename(optimizer.getDiagnostics().getFilename());
+      OptimizerContext context(*diagnostics[i], options, std::shared_ptr<SIR>());
+      context.getHardwareConfiguration() = optimizer.getHardwareConfiguration();
+      context.setPassProfiler(optimizer.getPassProfiler());
+      pushPasses(context);
+
+      DAWN_LOG(INFO) << "Starting " << pipelineName << " passes for `" << instantiation->getName()
+                     << "` ...";
+      try {
+        succeeded[i] =
+            context.getPassManager().runAllPassesOnStencilInstantiation(context, instantiation);
+      } catch(...) {
+        exceptions[i] = std::current_exception();
+      }
+      nextUIDs[i] = uidBlock.getNext();
+      DAWN_LOG(INFO) << "Done with " << pipelineName << " passes for `" << instantiation->getName()
+                     << "`";
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(int thread = 0; thread < numThreads; ++thread)
+    threads.emplace_back(worker);
+  for(auto& thread : threads)
+    thread.join();
+
+  // Give back the identifiers following the last one used, which fails if an instantiation has
+  // exhausted its block (or another compiler has reserved identifiers) in the meantime
+  const int endUID = getUIDBlock(numInstantiations);
+  UIDGenerator::getInstance()->rewind(*std::max_element(nextUIDs.begin(), nextUIDs.end()), endUID);
+
+  // Stop at the first failing instantiation, like the sequential pipeline
+  for(std::size_t i = 0; i < numInstantiations; ++i) {
+    for(const auto& diag : diagnostics[i]->getQueue())
+      optimizer.getDiagnostics().report(*diag);
+    if(exceptions[i])
+      std::rethrow_exception(exceptions[i]);
+    if(!succeeded[i])
+      throw std::runtime_error("An error occurred.");
+  }
+}
 } // namespace
 
-std::list<PassGroup> DawnCompiler::defaultPassGroups() {
-  return {PassGroup::SetStageName, PassGroup::StageReordering, PassGroup::StageMerger,
-          PassGroup::SetCaches, PassGroup::SetBlockSize};
+std::list<PassGroup> DawnCompiler::defaultPassGroups(const Options& options) {
+  std::list<PassGroup> groups = {PassGroup::SetStageName, PassGroup::StageReordering};
+  if(options.SplitStencils)
+    groups.push_back(PassGroup::StencilSplitting);
+  groups.insert(groups.end(),
+                {PassGroup::StageMerger, PassGroup::SetCaches, PassGroup::SetBlockSize});
+  return groups;
 }
 
 DawnCompiler::DawnCompiler(const Options& options) : diagnostics_(), options_(options) {}
@@ -160,40 +286,37 @@ DawnCompiler::lowerToIIR(const std::shared_ptr<SIR>& stencilIR) {
 
   OptimizerContext optimizer(getDiagnostics(), createOptimizerOptionsFromAllOptions(options_),
                              stencilIR);
-
-  using MultistageSplitStrategy = PassMultiStageSplitter::MultiStageSplittingStrategy;
-
-  // required passes to have proper, parallelized IR
-  optimizer.pushBackPass<PassInlining>(PassInlining::InlineStrategy::InlineProcedures);
-  optimizer.pushBackPass<PassFieldVersioning>();
-  optimizer.pushBackPass<PassMultiStageSplitter>(
-      options_.MaxCutMSS ? MultistageSplitStrategy::MaxCut : MultistageSplitStrategy::Optimized);
-  optimizer.pushBackPass<PassTemporaryType>();
-  optimizer.pushBackPass<PassLocalVarType>();
-  optimizer.pushBackPass<PassRemoveScalars>();
-  if(stencilIR->GridType == ast::GridType::Unstructured) {
-    optimizer.pushBackPass<PassStageSplitAllStatements>();
-    optimizer.pushBackPass<PassSetStageLocationType>();
-  } else {
-    optimizer.pushBackPass<PassStageSplitter>();
+  if(options_.PassTiming) {
+    // lowering starts a new compilation
+    passProfiler_ = std::make_unique<PassProfiler>();
+    optimizer.setPassProfiler(passProfiler_.get());
   }
-  optimizer.pushBackPass<PassTemporaryType>();
-  optimizer.pushBackPass<PassFixVersionedInputFields>();
-  optimizer.pushBackPass<PassSetSyncStage>();
-  // validation checks after parallelisation
-  optimizer.pushBackPass<PassValidation>();
 
-  for(auto& stencil : optimizer.getStencilInstantiationMap()) {
-    // Run optimization passes
-    auto& instantiation = stencil.second;
+  using MultistageSplitStrategy = PassMultiStageSplitter::MultiStageSplittingStrategy;
 
-    DAWN_LOG(INFO) << "Starting parallelization passes for `" << instantiation->getName()
-                   << "` ...";
-    if(!optimizer.getPassManager().runAllPassesOnStencilInstantiation(optimizer, instantiation))
-      throw std::runtime_error("An error occurred.");
+  auto pushPasses = [&](OptimizerContext& optimizer) {
+    // required passes to have proper, parallelized IR
+    optimizer.pushBackPass<PassInlining>(PassInlining::InlineStrategy::InlineProcedures);
+    optimizer.pushBackPass<PassFieldVersioning>();
+    optimizer.pushBackPass<PassMultiStageSplitter>(
+        options_.MaxCutMSS ? MultistageSplitStrategy::MaxCut : MultistageSplitStrategy::Optimized);
+    optimizer.pushBackPass<PassTemporaryType>();
+    optimizer.pushBackPass<PassLocalVarType>();
+    optimizer.pushBackPass<PassRemoveScalars>();
+    if(stencilIR->GridType == ast::GridType::Unstructured) {
+      optimizer.pushBackPass<PassStageSplitAllStatements>();
+      optimizer.pushBackPass<PassSetStageLocationType>();
+    } else {
+      optimizer.pushBackPass<PassStageSplitter>();
+    }
+    optimizer.pushBackPass<PassTemporaryType>();
+    optimizer.pushBackPass<PassFixVersionedInputFields>();
+    optimizer.pushBackPass<PassSetSyncStage>();
+    // validation checks after parallelisation
+    optimizer.pushBackPass<PassValidation>();
+  };
 
-    DAWN_LOG(INFO) << "Done with parallelization passes for `" << instantiation->getName() << "`";
-  }
+  runPassPipeline(optimizer, pushPasses, "parallelization");
 
   return optimizer.getStencilInstantiationMap();
 }
@@ -230,132 +353,163 @@ DawnCompiler::optimize(const std::map<std::string, std::shared_ptr<iir::StencilI
   // Initialize optimizer
   OptimizerContext optimizer(getDiagnostics(), createOptimizerOptionsFromAllOptions(options_),
                              stencilInstantiationMap);
+  if(!options_.HardwareConfigFile.empty()) {
+    try {
+      optimizer.getHardwareConfiguration().readJSON(options_.HardwareConfigFile);
+    } catch(const std::runtime_error& e) {
+      DiagnosticsBuilder diag(DiagnosticsKind::Error);
+      diag << e.what();
+      diagnostics_.report(diag);
+      throw std::runtime_error("An error occurred.");
+    }
+  }
+  if(options_.PassTiming) {
+    if(!passProfiler_)
+      passProfiler_ = std::make_unique<PassProfiler>();
+    optimizer.setPassProfiler(passProfiler_.get());
+  }
 
-  for(auto group : groups) {
-    switch(group) {
-    case PassGroup::SSA:
-      DAWN_ASSERT_MSG(false, "The SSA pass is broken.");
-      // broken but should run with no prerequisites
-      optimizer.pushBackPass<PassSSA>();
-      // rerun things we might have changed
-      // optimizer.pushBackPass<PassFixVersionedInputFields>();
-      // todo: this does not work since it does not check if it was already run
-      break;
-    case PassGroup::PrintStencilGraph:
-      optimizer.pushBackPass<PassSetDependencyGraph>();
-      // Plain diagnostics, should not even be a pass but is independent
-      optimizer.pushBackPass<PassPrintStencilGraph>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::SetStageName:
-      // This is never used but if we want to reenable it, it is independent
-      optimizer.pushBackPass<PassSetStageName>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::StageReordering:
-      optimizer.pushBackPass<PassSetStageGraph>();
-      optimizer.pushBackPass<PassSetDependencyGraph>();
-      optimizer.pushBackPass<PassStageReordering>(reorderStrategy);
-      // moved stages around ...
-      optimizer.pushBackPass<PassSetSyncStage>();
-      // if we want this info around, we should probably run this also
-      // optimizer.pushBackPass<PassSetStageName>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::StageMerger:
-      // merging requires the stage graph
-      optimizer.pushBackPass<PassSetStageGraph>();
-      optimizer.pushBackPass<PassSetDependencyGraph>();
-      // running the actual pass
-      optimizer.pushBackPass<PassStageMerger>();
-      // since this can change the scope of temporaries ...
-      optimizer.pushBackPass<PassTemporaryType>();
-      optimizer.pushBackPass<PassLocalVarType>();
-      optimizer.pushBackPass<PassRemoveScalars>();
-      // modify stage dependencies
-      optimizer.pushBackPass<PassSetSyncStage>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::TemporaryMerger:
-      optimizer.pushBackPass<PassTemporaryMerger>();
-      // this should not affect the temporaries but since we're touching them it would probably be a
-      // safe idea
-      optimizer.pushBackPass<PassTemporaryType>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::Inlining:
+  auto pushPasses = [&](OptimizerContext& optimizer) {
+    for(auto group : groups) {
+      switch(group) {
+      case PassGroup::SSA:
+        DAWN_ASSERT_MSG(false, "The SSA pass is broken.");
+        // broken but should run with no prerequisites
+        optimizer.pushBackPass<PassSSA>();
+        // rerun things we might have changed
+        // optimizer.pushBackPass<PassFixVersionedInputFields>();
+        // todo: this does not work since it does not check if it was already run
+        break;
+      case PassGroup::PrintStencilGraph:
+        optimizer.pushBackPass<PassSetDependencyGraph>();
+        // Plain diagnostics, should not even be a pass but is independent
+        optimizer.pushBackPass<PassPrintStencilGraph>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::SetStageName:
+        // This is never used but if we want to reenable it, it is independent
+        optimizer.pushBackPass<PassSetStageName>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::StageReordering:
+        optimizer.pushBackPass<PassSetStageGraph>();
+        optimizer.pushBackPass<PassSetDependencyGraph>();
+        optimizer.pushBackPass<PassStageReordering>(reorderStrategy);
+        // moved stages around ...
+        optimizer.pushBackPass<PassSetSyncStage>();
+        // if we want this info around, we should probably run this also
+        // optimizer.pushBackPass<PassSetStageName>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::StencilSplitting:
+        // splitting requires the stage graph
+        optimizer.pushBackPass<PassSetStageGraph>();
+        optimizer.pushBackPass<PassStencilSplitter>(options_.MaxFieldsPerStencil);
+        // stages may now be in different stencils
+        optimizer.pushBackPass<PassSetSyncStage>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::StageMerger:
+        // merging requires the stage graph
+        optimizer.pushBackPass<PassSetStageGraph>();
+        optimizer.pushBackPass<PassSetDependencyGraph>();
+        // running the actual pass
+        optimizer.pushBackPass<PassStageMerger>();
+        // since this can change the scope of temporaries ...
+        optimizer.pushBackPass<PassTemporaryType>();
+        optimizer.pushBackPass<PassLocalVarType>();
+        optimizer.pushBackPass<PassRemoveScalars>();
+        // modify stage dependencies
+        optimizer.pushBackPass<PassSetSyncStage>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::TemporaryMerger:
+        optimizer.pushBackPass<PassTemporaryMerger>();
+        // this should not affect the temporaries but since we're touching them it would probably be
+        // a safe idea
+        optimizer.pushBackPass<PassTemporaryType>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::Inlining:
+        optimizer.pushBackPass<PassInlining>(PassInlining::InlineStrategy::ComputationsOnTheFly);
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::IntervalPartitioning:
+        optimizer.pushBackPass<PassIntervalPartitioning>();
+        // since this can change the scope of temporaries ...
+        optimizer.pushBackPass<PassTemporaryType>();
+        // optimizer.pushBackPass<PassFixVersionedInputFields>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::TmpToStencilFunction:
+        optimizer.pushBackPass<PassTemporaryToStencilFunction>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::SetNonTempCaches:
+        optimizer.pushBackPass<PassSetNonTempCaches>();
+        // this should not affect the temporaries but since we're touching them it would probably be
+        // a safe idea
+        optimizer.pushBackPass<PassTemporaryType>();
+        optimizer.pushBackPass<PassLocalVarType>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::SetCaches:
+        optimizer.pushBackPass<PassSetCaches>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::SetBlockSize:
+        optimizer.pushBackPass<PassSetBlockSize>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::DataLocalityMetric:
+        // Plain diagnostics, should not even be a pass but is independent
+        optimizer.pushBackPass<PassDataLocalityMetric>();
+        // validation check
+        optimizer.pushBackPass<PassValidation>();
+        break;
+      case PassGroup::Parallel:
+        DAWN_ASSERT_MSG(false, "The parallel group is only valid for lowering to IIR.");
+      }
+    }
+    if(options_.Backend == "cuda" || options_.SerializeIIR) {
       optimizer.pushBackPass<PassInlining>(PassInlining::InlineStrategy::ComputationsOnTheFly);
       // validation check
       optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::IntervalPartitioning:
-      optimizer.pushBackPass<PassIntervalPartitioning>();
-      // since this can change the scope of temporaries ...
-      optimizer.pushBackPass<PassTemporaryType>();
-      // optimizer.pushBackPass<PassFixVersionedInputFields>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::TmpToStencilFunction:
-      optimizer.pushBackPass<PassTemporaryToStencilFunction>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::SetNonTempCaches:
-      optimizer.pushBackPass<PassSetNonTempCaches>();
-      // this should not affect the temporaries but since we're touching them it would probably be a
-      // safe idea
-      optimizer.pushBackPass<PassTemporaryType>();
-      optimizer.pushBackPass<PassLocalVarType>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::SetCaches:
-      optimizer.pushBackPass<PassSetCaches>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::SetBlockSize:
-      optimizer.pushBackPass<PassSetBlockSize>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::DataLocalityMetric:
-      // Plain diagnostics, should not even be a pass but is independent
-      optimizer.pushBackPass<PassDataLocalityMetric>();
-      // validation check
-      optimizer.pushBackPass<PassValidation>();
-      break;
-    case PassGroup::Parallel:
-      DAWN_ASSERT_MSG(false, "The parallel group is only valid for lowering to IIR.");
     }
-  }
-  if(options_.Backend == "cuda" || options_.SerializeIIR) {
-    optimizer.pushBackPass<PassInlining>(PassInlining::InlineStrategy::ComputationsOnTheFly);
-    // validation check
-    optimizer.pushBackPass<PassValidation>();
-  }
+  };
 
   //===-----------------------------------------------------------------------------------------
 
+  runPassPipeline(optimizer, pushPasses, "optimization and analysis");
+
+  if(passProfiler_) {
+    // stdout may carry the generated code or IIR
+    passProfiler_->printSummary(std::cerr);
+    if(!options_.PassTimingTrace.empty() &&
+       !passProfiler_->writeTrace(options_.PassTimingTrace)) {
+      DiagnosticsBuilder diag(DiagnosticsKind::Warning, SourceLocation());
+      diag << "cannot write pass timing trace '" << options_.PassTimingTrace << "'";
+      diagnostics_.report(diag);
+    }
+    passProfiler_.reset();
+  }
+
   int i = 0;
   for(auto& stencil : optimizer.getStencilInstantiationMap()) {
-    // Run optimization passes
     auto& instantiation = stencil.second;
 
-    DAWN_LOG(INFO) << "Starting optimization and analysis passes for `" << instantiation->getName()
-                   << "` ...";
-    if(!optimizer.getPassManager().runAllPassesOnStencilInstantiation(optimizer, instantiation))
-      throw std::runtime_error("An error occurred.");
-
-    DAWN_LOG(INFO) << "Done with optimization and analysis passes for `" << instantiation->getName()
-                   << "`";
-
     if(options_.SerializeIIR) {
       const auto p =
           fs::path(options_.OutputFile.empty() ? instantiation->getMetaData().getFileName()
@@ -395,8 +549,16 @@ DawnCompiler::generate(const std::map<std::string, std::shared_ptr<iir::StencilI
       return CG.generateCode();
     }
     case BackendType::CXXNaive: {
+      const std::string dims = "ijk";
+      if(options_.LoopOrder.size() != dims.size() ||
+         !std::is_permutation(options_.LoopOrder.begin(), options_.LoopOrder.end(), dims.begin())) {
+        diagnostics_.report(
+            buildDiag("-loop-order", options_.LoopOrder, "must be a permutation of 'ijk'"));
+        return nullptr;
+      }
       codegen::cxxnaive::CXXNaiveCodeGen CG(stencilInstantiationMap, diagnostics_,
-                                            options_.MaxHaloPoints);
+                                            options_.MaxHaloPoints, options_.LoopOrder,
+                                            options_.Timers);
       return CG.generateCode();
     }
     case BackendType::CUDA: {
@@ -407,12 +569,17 @@ DawnCompiler::generate(const std::map<std::string, std::shared_ptr<iir::StencilI
     }
     case BackendType::CXXNaiveIco: {
       codegen::cxxnaiveico::CXXNaiveIcoCodeGen CG(stencilInstantiationMap, diagnostics_,
-                                                  options_.MaxHaloPoints);
+                                                  options_.MaxHaloPoints, options_.StaticNbhChains,
+                                                  options_.KInnerLoops, options_.OpenMPLoops,
+                                                  options_.Timers);
 
       return CG.generateCode();
     }
-    case BackendType::CXXOpt:
-      dawn_unreachable("GTClangOptCXX not supported yet");
+    case BackendType::CXXOpt: {
+      codegen::cxxopt::CXXOptCodeGen CG(stencilInstantiationMap, diagnostics_,
+                                        options_.MaxHaloPoints);
+      return CG.generateCode();
+    }
     }
   } catch(...) {
     DiagnosticsBuilder diag(DiagnosticsKind::Error);
@@ -425,7 +592,21 @@ DawnCompiler::generate(const std::map<std::string, std::shared_ptr<iir::StencilI
 std::unique_ptr<codegen::TranslationUnit>
 DawnCompiler::compile(const std::shared_ptr<SIR>& stencilIR, std::list<PassGroup> groups) {
   if(groups.empty())
-    groups = defaultPassGroups();
+    groups = defaultPassGroups(options_);
+
+  // Look up the generated code of a previous compilation of the same SIR
+  std::unique_ptr<CompilationCache> cache;
+  std::string cacheInput, cacheKey;
+  if(!options_.CacheDir.empty() && CompilationCache::isCacheable(options_)) {
+    cache = std::make_unique<CompilationCache>(
+        options_.CacheDir, static_cast<std::uintmax_t>(options_.CacheMaxSize) * 1024 * 1024);
+    cacheInput = CompilationCache::computeInput(*stencilIR, options_, groups);
+    cacheKey = CompilationCache::computeKey(cacheInput);
+    if(auto translationUnit = cache->lookup(cacheKey, cacheInput)) {
+      DAWN_LOG(INFO) << "Reusing the generated code of compilation " << cacheKey;
+      return translationUnit;
+    }
+  }
 
   // Parallelize the SIR
   std::map<std::string, std::shared_ptr<iir::StencilInstantiation>> SIM, optimizedSIM;
@@ -445,7 +626,11 @@ DawnCompiler::compile(const std::shared_ptr<SIR>& stencilIR, std::list<PassGroup
   }
 
   // Generate the Code
-  return generate(optimizedSIM);
+  // A hit does not replay the diagnostics, hence only compilations without any are cached
+  auto translationUnit = generate(optimizedSIM);
+  if(cache && translationUnit && !diagnostics_.hasDiags())
+    cache->insert(cacheKey, cacheInput, *translationUnit);
+  return translationUnit;
 }
 
 const DiagnosticsEngine& DawnCompiler::getDiagnostics() const { return diagnostics_; }
@@ -18,6 +18,7 @@
 #include "dawn/CodeGen/TranslationUnit.h"
 #include "dawn/Compiler/Options.h"
 #include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassProfiler.h"
 #include "dawn/Support/DiagnosticsEngine.h"
 #include "dawn/Support/NonCopyable.h"
 
@@ -35,6 +36,7 @@ enum class PassGroup {
   PrintStencilGraph,
   SetStageName,
   StageReordering,
+  StencilSplitting,
   StageMerger,
   TemporaryMerger,
   Inlining,
@@ -52,12 +54,19 @@ class DawnCompiler : NonCopyable {
   DiagnosticsEngine diagnostics_;
   Options options_;
 
+  /// Profiler of the passes run by `lowerToIIR` and `optimize` (only with `-pass-timing`)
+  std::unique_ptr<PassProfiler> passProfiler_;
+
 public:
   /// @brief Initialize the compiler by setting up diagnostics
   DawnCompiler() = default;
   DawnCompiler(const Options& options);
 
   /// @brief Apply parallelizer, code optimization, and generate
+  ///
+  /// If `Options::CacheDir` is set, the generated code is looked up in and stored to the
+  /// compilation cache in that directory (see `CompilationCache`). Compilations reporting any
+  /// diagnostics are not stored, as a hit would not report them.
   std::unique_ptr<codegen::TranslationUnit> compile(const std::shared_ptr<SIR>& stencilIR,
                                                     std::list<PassGroup> groups = {});
 
@@ -76,7 +85,10 @@ public:
   generate(const std::map<std::string, std::shared_ptr<iir::StencilInstantiation>>&
                stencilInstantiationMap);
 
-  static std::list<PassGroup> defaultPassGroups();
+  /// @brief Get the pass groups run by default with `options`
+  ///
+  /// The stencil splitting group is only part of them if `-split-stencils` is passed.
+  static std::list<PassGroup> defaultPassGroups(const Options& options = Options());
 
   /// @brief Get options
   const Options& getOptions() const;
@@ -21,7 +21,6 @@
 #include <fstream>
 #include <iosfwd>
 #include <iterator>
-#include <list>
 #include <memory>
 #include <set>
 #include <sstream>
@@ -34,6 +33,10 @@ namespace dawn {
 namespace iir {
 
 /// @brief CRTP base class of all dependency graphs
+///
+/// Vertices are numbered densely in the order of their insertion (`VertexID`). The outgoing edges
+/// of a vertex are stored contiguously, the value of a vertex is looked up by its `VertexID` in
+/// constant time.
 /// @ingroup optimizer
 template <class Derived, class EdgeData>
 class DependencyGraph {
@@ -57,7 +60,7 @@ public:
     bool operator!=(const Edge& other) const { return !(*this == other); }
   };
 
-  using EdgeList = std::list<Edge>;
+  using EdgeList = std::vector<Edge>;
 
   struct Vertex {
     std::size_t VertexID; ///< Unique ID of the Vertex
@@ -71,6 +74,7 @@ public:
 protected:
   std::unordered_map<int, Vertex> vertices_;
   std::vector<EdgeList> adjacencyList_;
+  std::vector<int> vertexValues_; ///< Value of each vertex indexed by its `VertexID`
 
 public:
   bool operator==(const DependencyGraph& other) const {
@@ -99,8 +103,10 @@ public:
   /// @brief Insert a new node
   Vertex& insertNode(int ID) {
     auto [iter, inserted] = vertices_.emplace(ID, Vertex{adjacencyList_.size(), ID});
-    if(inserted)
+    if(inserted) {
       adjacencyList_.push_back(EdgeList());
+      vertexValues_.push_back(ID);
+    }
     return iter->second;
   }
 
@@ -130,19 +136,22 @@ public:
     // if the node does already exist)
     static_cast<Derived*>(this)->insertNode(vertexValueTo);
 
-    // Traverse the edge-list of node `IDFrom` to check if we already have such an edge
-    auto& edgeList = adjacencyList_[getVertexIDFromValue(vertexValueFrom)];
-    const Edge edge{std::forward<TEdgeData>(data), getVertexIDFromValue(vertexValueFrom),
-                    getVertexIDFromValue(vertexValueTo)};
+    insertEdgeByVertexID(getVertexIDFromValue(vertexValueFrom),
+                         getVertexIDFromValue(vertexValueTo), std::forward<TEdgeData>(data));
+  }
 
-    auto it = std::find_if(edgeList.begin(), edgeList.end(), [&edge](const Edge& e) {
-      return e.FromVertexID == edge.FromVertexID && e.ToVertexID == edge.ToVertexID;
-    });
+  /// @brief Insert a new edge between the existing vertices `FromVertexID` and `ToVertexID`
+  template <typename TEdgeData>
+  void insertEdgeByVertexID(std::size_t FromVertexID, std::size_t ToVertexID, TEdgeData&& data) {
+    // Traverse the edge-list of node `FromVertexID` to check if we already have such an edge
+    auto& edgeList = adjacencyList_[FromVertexID];
+    auto it = std::find_if(edgeList.begin(), edgeList.end(),
+                           [&](const Edge& e) { return e.ToVertexID == ToVertexID; });
 
     if(it != edgeList.end())
-      static_cast<Derived*>(this)->edgeAlreadyExists(it->Data, edge.Data);
+      static_cast<Derived*>(this)->edgeAlreadyExists(it->Data, data);
     else
-      edgeList.push_back(edge);
+      edgeList.push_back(Edge{std::forward<TEdgeData>(data), FromVertexID, ToVertexID});
   }
 
   /// @brief Callback which will be invoked if an edge already exists
@@ -165,10 +174,8 @@ public:
 
   /// @brief Get the ID of the vertex given by ID
   int getValueFromVertexID(std::size_t VertexID) const {
-    for(const auto& vertexPair : vertices_)
-      if(vertexPair.second.VertexID == VertexID)
-        return vertexPair.first;
-    dawn_unreachable("invalid VertexID");
+    DAWN_ASSERT_MSG(VertexID < vertexValues_.size(), "invalid VertexID");
+    return vertexValues_[VertexID];
   }
 
   /// @brief Get the list of edges of node given by `ID`
@@ -181,6 +188,7 @@ public:
   void clear() {
     vertices_.clear();
     adjacencyList_.clear();
+    vertexValues_.clear();
   }
 
   /// @brief Check if graph is empty
@@ -210,7 +218,7 @@ public:
   std::string toString() const {
     std::stringstream ss;
     for(std::size_t VertexID = 0; VertexID < adjacencyList_.size(); ++VertexID) {
-      for(const Edge& edge : *(adjacencyList_[VertexID])) {
+      for(const Edge& edge : adjacencyList_[VertexID]) {
         ss << static_cast<const Derived*>(this)->getVertexNameByVertexID(edge.FromVertexID)
            << static_cast<const Derived*>(this)->edgeDataToString(edge.Data)
            << static_cast<const Derived*>(this)->getVertexNameByVertexID(edge.ToVertexID) << "\n";
@@ -40,12 +40,6 @@ void DependencyGraphAccesses::insertStatement(const std::shared_ptr<iir::Stmt>&
   }
 }
 
-DependencyGraphAccesses::Vertex& DependencyGraphAccesses::insertNode(int ID) {
-  Vertex& vertex = Base::insertNode(ID);
-  VertexIDToAccessIDMap_.emplace(vertex.VertexID, vertex.Value);
-  return vertex;
-}
-
 void DependencyGraphAccesses::edgeAlreadyExists(DependencyGraphAccesses::EdgeData& existingEdge,
                                                 const DependencyGraphAccesses::EdgeData& newEdge) {
   if(!newEdge.isPointwise())
@@ -53,9 +47,7 @@ void DependencyGraphAccesses::edgeAlreadyExists(DependencyGraphAccesses::EdgeDat
 }
 
 int DependencyGraphAccesses::getIDFromVertexID(std::size_t VertexID) const {
-  auto it = VertexIDToAccessIDMap_.find(VertexID);
-  DAWN_ASSERT_MSG(it != VertexIDToAccessIDMap_.end(), "Node with given VertexID does not exist");
-  return it->second;
+  return getValueFromVertexID(VertexID);
 }
 
 const char* DependencyGraphAccesses::edgeDataToString(const EdgeData& data) const {
@@ -85,19 +77,15 @@ std::string DependencyGraphAccesses::getVertexNameByVertexID(std::size_t VertexI
 }
 
 void DependencyGraphAccesses::merge(const DependencyGraphAccesses& other) {
-  // Insert the nodes of `other`
-  for(const auto& AccessIDVertexIDPair : other.getVertices()) {
-    int AccessID = AccessIDVertexIDPair.first;
-    insertNode(AccessID);
-  }
+  // Insert the nodes of `other` and map their VertexIDs to the ones in `this`
+  std::vector<std::size_t> vertexIDs(other.adjacencyList_.size());
+  for(const auto& AccessIDVertexPair : other.getVertices())
+    vertexIDs[AccessIDVertexPair.second.VertexID] = insertNode(AccessIDVertexPair.first).VertexID;
 
   // Insert the edges of `other`
-  for(std::size_t VertexID = 0; VertexID < other.getAdjacencyList().size(); ++VertexID) {
-    for(const Edge& edge : other.getAdjacencyList()[VertexID]) {
-      insertEdge(other.getIDFromVertexID(edge.FromVertexID),
-                 other.getIDFromVertexID(edge.ToVertexID), edge.Data);
-    }
-  }
+  for(const EdgeList& edgeList : other.adjacencyList_)
+    for(const Edge& edge : edgeList)
+      insertEdgeByVertexID(vertexIDs[edge.FromVertexID], vertexIDs[edge.ToVertexID], edge.Data);
 }
 
 std::vector<std::set<std::size_t>> DependencyGraphAccesses::partitionInSubGraphs() const {
@@ -527,11 +515,6 @@ void DependencyGraphAccesses::greedyColoring(std::unordered_map<int, int>& color
   return GreedyColoring(this, coloring).compute();
 }
 
-void DependencyGraphAccesses::clear() {
-  Base::clear();
-  VertexIDToAccessIDMap_.clear();
-}
-
 void DependencyGraphAccesses::toJSON(const std::string& file, DiagnosticsEngine& diagEngine) const {
   StencilMetaInformation const& metaData = metaData_;
 
@@ -604,7 +587,7 @@ void DependencyGraphAccesses::toJSON(const std::string& file, DiagnosticsEngine&
   ofs.close();
 }
 
-bool DependencyGraphAccesses::exceedsMaxBoundaryPoints(int maxHorizontalBoundaryExtent) {
+bool DependencyGraphAccesses::exceedsMaxBoundaryPoints(int maxHorizontalBoundaryExtent) const {
   std::unordered_map<std::size_t, Extents> extentMap = computeBoundaryExtents(this);
 
   for(const auto& vertexIDExtentsPair : extentMap) {
@@ -619,5 +602,17 @@ bool DependencyGraphAccesses::exceedsMaxBoundaryPoints(int maxHorizontalBoundary
   return false;
 }
 
+int DependencyGraphAccesses::getNumBoundaryPoints() const {
+  std::unordered_map<std::size_t, Extents> extentMap = computeBoundaryExtents(this);
+
+  int numBoundaryPoints = 0;
+  for(const auto& vertexIDExtentsPair : extentMap) {
+    auto const& hExtent =
+        extent_cast<iir::CartesianExtent const&>(vertexIDExtentsPair.second.horizontalExtent());
+    numBoundaryPoints += hExtent.iPlus() - hExtent.iMinus() + hExtent.jPlus() - hExtent.jMinus();
+  }
+  return numBoundaryPoints;
+}
+
 } // namespace iir
 } // namespace dawn
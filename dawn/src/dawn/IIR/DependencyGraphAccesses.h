@@ -61,7 +61,6 @@ class DependencyGraphAccesses
     : public DependencyGraph<DependencyGraphAccesses, DependencyGraphAccessesEdgeData> {
 
   std::reference_wrapper<const StencilMetaInformation> metaData_;
-  std::unordered_map<std::size_t, int> VertexIDToAccessIDMap_;
 
 public:
   using Base = DependencyGraph<DependencyGraphAccesses, DependencyGraphAccessesEdgeData>;
@@ -82,9 +81,7 @@ public:
       merge(g);
   }
 
-  bool operator==(const DependencyGraphAccesses& other) const {
-    return Base::operator==(other) && (VertexIDToAccessIDMap_ == other.VertexIDToAccessIDMap_);
-  }
+  bool operator==(const DependencyGraphAccesses& other) const { return Base::operator==(other); }
 
   /// @brief Process the statement and insert it into the current graph
   ///
@@ -98,9 +95,6 @@ public:
   /// Note that only child-less nodes are processed.
   void insertStatement(const std::shared_ptr<iir::Stmt>& stmt);
 
-  /// @brief Insert a new node
-  Vertex& insertNode(int ID);
-
   /// @brief Merge extents if edge already exists
   void edgeAlreadyExists(EdgeData& existingEdge, const EdgeData& newEdge);
 
@@ -168,9 +162,6 @@ public:
   /// @see https://en.wikipedia.org/wiki/Greedy_coloring
   void greedyColoring(std::unordered_map<int, int>& coloring) const;
 
-  /// @brief Clear the graph
-  void clear();
-
   /// @brief Serialize the graph to JSON
   void toJSON(const std::string& file, DiagnosticsEngine& diagEngine) const;
 
@@ -178,7 +169,11 @@ public:
   /// @brief Check if any field, referenced in `graph`, exceeds the maximum number of boundary
   /// points in the @b horizontal
   /// @ingroup optimizer
-  bool exceedsMaxBoundaryPoints(int maxHorizontalBoundaryExtent);
+  bool exceedsMaxBoundaryPoints(int maxHorizontalBoundaryExtent) const;
+
+  /// @brief Compute the number of horizontal halo lines, accumulated over all fields referenced in
+  /// the graph, which are required to evaluate the graph (i.e the halo-exchange volume per level)
+  int getNumBoundaryPoints() const;
 };
 } // namespace iir
 } // namespace dawn
@@ -58,20 +58,6 @@ Extent limit(Extent lhs, Extent const& rhs) {
   return rhs;
 }
 
-// HorizontalExtentImpl
-HorizontalExtentImpl& HorizontalExtentImpl::operator+=(HorizontalExtentImpl const& other) {
-  addImpl(other);
-  return *this;
-}
-std::unique_ptr<HorizontalExtentImpl> HorizontalExtentImpl::clone() const { return cloneImpl(); }
-void HorizontalExtentImpl::merge(HorizontalExtentImpl const& other) { mergeImpl(other); }
-void HorizontalExtentImpl::addCenter() { addCenterImpl(); }
-bool HorizontalExtentImpl::operator==(HorizontalExtentImpl const& other) const {
-  return equalsImpl(other);
-}
-bool HorizontalExtentImpl::isPointwise() const { return isPointwiseImpl(); }
-void HorizontalExtentImpl::limit(HorizontalExtentImpl const& other) { limitImpl(other); }
-
 // CartesianExtent
 CartesianExtent::CartesianExtent(Extent const& iExtent, Extent const& jExtent)
     : extents_{iExtent, jExtent} {}
@@ -83,36 +69,29 @@ int CartesianExtent::iPlus() const { return extents_[0].plus(); }
 int CartesianExtent::jMinus() const { return extents_[1].minus(); }
 int CartesianExtent::jPlus() const { return extents_[1].plus(); }
 
-void CartesianExtent::addImpl(HorizontalExtentImpl const& other) {
-  auto const& otherCartesian = dynamic_cast<CartesianExtent const&>(other);
-  extents_[0] += otherCartesian.extents_[0];
-  extents_[1] += otherCartesian.extents_[1];
+CartesianExtent& CartesianExtent::operator+=(CartesianExtent const& other) {
+  extents_[0] += other.extents_[0];
+  extents_[1] += other.extents_[1];
+  return *this;
 }
-void CartesianExtent::mergeImpl(HorizontalExtentImpl const& other) {
-  auto const& otherCartesian = dynamic_cast<CartesianExtent const&>(other);
-  extents_[0].merge(otherCartesian.extents_[0]);
-  extents_[1].merge(otherCartesian.extents_[1]);
+void CartesianExtent::merge(CartesianExtent const& other) {
+  extents_[0].merge(other.extents_[0]);
+  extents_[1].merge(other.extents_[1]);
 }
 
-void CartesianExtent::addCenterImpl() { mergeImpl(CartesianExtent()); }
+void CartesianExtent::addCenter() { merge(CartesianExtent()); }
 
-bool CartesianExtent::equalsImpl(HorizontalExtentImpl const& other) const {
-  auto const& otherCartesian = dynamic_cast<CartesianExtent const&>(other);
-  return extents_[0] == otherCartesian.extents_[0] && extents_[1] == otherCartesian.extents_[1];
+bool CartesianExtent::operator==(CartesianExtent const& other) const {
+  return extents_[0] == other.extents_[0] && extents_[1] == other.extents_[1];
 }
 
-std::unique_ptr<HorizontalExtentImpl> CartesianExtent::cloneImpl() const {
-  return std::make_unique<CartesianExtent>(extents_[0].minus(), extents_[0].plus(),
-                                           extents_[1].minus(), extents_[1].plus());
-}
-bool CartesianExtent::isPointwiseImpl() const {
+bool CartesianExtent::isPointwise() const {
   return extents_[0].isPointwise() && extents_[1].isPointwise();
 }
 
-void CartesianExtent::limitImpl(HorizontalExtentImpl const& other) {
-  auto const& otherCartesian = dynamic_cast<CartesianExtent const&>(other);
-  extents_[0].limit(otherCartesian.extents_[0]);
-  extents_[1].limit(otherCartesian.extents_[1]);
+void CartesianExtent::limit(CartesianExtent const& other) {
+  extents_[0].limit(other.extents_[0]);
+  extents_[1].limit(other.extents_[1]);
 }
 
 // UnstructuredExtent
@@ -120,32 +99,25 @@ UnstructuredExtent::UnstructuredExtent(bool hasExtent) : hasExtent_{hasExtent} {
 UnstructuredExtent::UnstructuredExtent() : UnstructuredExtent(false) {}
 
 bool UnstructuredExtent::hasExtent() const { return hasExtent_; }
-void UnstructuredExtent::addImpl(HorizontalExtentImpl const& other) {
-  auto const& otherUnstructured = dynamic_cast<UnstructuredExtent const&>(other);
-  hasExtent_ = hasExtent_ || otherUnstructured.hasExtent_;
+UnstructuredExtent& UnstructuredExtent::operator+=(UnstructuredExtent const& other) {
+  hasExtent_ = hasExtent_ || other.hasExtent_;
+  return *this;
 }
 
-void UnstructuredExtent::mergeImpl(HorizontalExtentImpl const& other) {
-  auto const& otherUnstructured = dynamic_cast<UnstructuredExtent const&>(other);
-  hasExtent_ = hasExtent_ || otherUnstructured.hasExtent_;
+void UnstructuredExtent::merge(UnstructuredExtent const& other) {
+  hasExtent_ = hasExtent_ || other.hasExtent_;
 }
 
-void UnstructuredExtent::addCenterImpl() { mergeImpl(UnstructuredExtent()); }
+void UnstructuredExtent::addCenter() { merge(UnstructuredExtent()); }
 
-bool UnstructuredExtent::equalsImpl(HorizontalExtentImpl const& other) const {
-  auto const& otherUnstructured = dynamic_cast<dawn::iir::UnstructuredExtent const&>(other);
-  return hasExtent_ == otherUnstructured.hasExtent_;
+bool UnstructuredExtent::operator==(UnstructuredExtent const& other) const {
+  return hasExtent_ == other.hasExtent_;
 }
 
-std::unique_ptr<HorizontalExtentImpl> UnstructuredExtent::cloneImpl() const {
-  return std::make_unique<UnstructuredExtent>(hasExtent_);
-}
-
-bool UnstructuredExtent::isPointwiseImpl() const { return !hasExtent_; }
+bool UnstructuredExtent::isPointwise() const { return !hasExtent_; }
 
-void UnstructuredExtent::limitImpl(HorizontalExtentImpl const& other) {
-  auto const& otherUnstructured = dynamic_cast<dawn::iir::UnstructuredExtent const&>(other);
-  hasExtent_ = hasExtent_ && otherUnstructured.hasExtent_;
+void UnstructuredExtent::limit(UnstructuredExtent const& other) {
+  hasExtent_ = hasExtent_ && other.hasExtent_;
 }
 
 // HorizontalExtent
@@ -161,70 +133,81 @@ HorizontalExtent::HorizontalExtent(ast::HorizontalOffset const& hOffset) {
                           },
                           []() { return HorizontalExtent(); });
 }
-HorizontalExtent::HorizontalExtent(ast::cartesian_) : impl_(std::make_unique<CartesianExtent>()) {}
+HorizontalExtent::HorizontalExtent(ast::cartesian_) : impl_(CartesianExtent()) {}
 HorizontalExtent::HorizontalExtent(ast::cartesian_, int iMinus, int iPlus, int jMinus, int jPlus)
-    : impl_(std::make_unique<CartesianExtent>(iMinus, iPlus, jMinus, jPlus)) {}
+    : impl_(CartesianExtent(iMinus, iPlus, jMinus, jPlus)) {}
 
-HorizontalExtent::HorizontalExtent(ast::unstructured_)
-    : impl_(std::make_unique<UnstructuredExtent>()) {}
+HorizontalExtent::HorizontalExtent(ast::unstructured_) : impl_(UnstructuredExtent()) {}
 HorizontalExtent::HorizontalExtent(ast::unstructured_, bool hasExtent)
-    : impl_(std::make_unique<UnstructuredExtent>(hasExtent)) {}
-
-HorizontalExtent::HorizontalExtent(HorizontalExtent const& other)
-    : impl_(other.impl_ ? other.impl_->clone() : nullptr) {}
-HorizontalExtent& HorizontalExtent::operator=(HorizontalExtent const& other) {
-  if(other.impl_)
-    impl_ = other.impl_->clone();
-  else
-    impl_ = nullptr;
-  return *this;
+    : impl_(UnstructuredExtent(hasExtent)) {}
+
+template <typename Fn>
+void HorizontalExtent::apply(HorizontalExtent const& other, Fn const& fn) {
+  std::visit(
+      [&](auto& lhs, auto const& rhs) {
+        using Lhs = std::decay_t<decltype(lhs)>;
+        if constexpr(std::is_same_v<Lhs, std::decay_t<decltype(rhs)>> &&
+                     !std::is_same_v<Lhs, std::monostate>)
+          fn(lhs, rhs);
+        else
+          throw std::bad_cast();
+      },
+      impl_, other.impl_);
 }
 
-HorizontalExtent::HorizontalExtent(std::unique_ptr<HorizontalExtentImpl> impl)
-    : impl_(std::move(impl)) {}
 bool HorizontalExtent::operator==(HorizontalExtent const& other) const {
-  if(impl_ && other.impl_)
-    return *impl_ == *other.impl_;
-  else if(impl_)
+  if(hasType() && other.hasType()) {
+    if(impl_.index() != other.impl_.index())
+      throw std::bad_cast();
+    return impl_ == other.impl_;
+  } else if(hasType())
     return isPointwise();
-  else if(other.impl_)
+  else if(other.hasType())
     return other.isPointwise();
   else
     return true;
 }
 bool HorizontalExtent::operator!=(HorizontalExtent const& other) const { return !(*this == other); }
 HorizontalExtent& HorizontalExtent::operator+=(HorizontalExtent const& other) {
-  if(impl_ && other.impl_)
-    *impl_ += *other.impl_;
-  else if(other.impl_)
+  if(hasType() && other.hasType())
+    apply(other, [](auto& lhs, auto const& rhs) { lhs += rhs; });
+  else if(other.hasType())
     *this = other;
 
   return *this;
 }
 void HorizontalExtent::merge(HorizontalExtent const& other) {
-  if(impl_ && other.impl_)
-    impl_->merge(*other.impl_);
-  else if(impl_)
-    impl_->addCenter();
-  else if(other.impl_) {
+  if(hasType() && other.hasType())
+    apply(other, [](auto& lhs, auto const& rhs) { lhs.merge(rhs); });
+  else if(auto cartesianExtent = std::get_if<CartesianExtent>(&impl_))
+    cartesianExtent->addCenter();
+  else if(auto unstructuredExtent = std::get_if<UnstructuredExtent>(&impl_))
+    unstructuredExtent->addCenter();
+  else if(other.hasType()) {
     *this = other;
-    impl_->addCenter();
+    merge(HorizontalExtent());
   }
 }
 void HorizontalExtent::merge(ast::HorizontalOffset const& other) { merge(HorizontalExtent{other}); }
-bool HorizontalExtent::isPointwise() const { return !impl_ || impl_->isPointwise(); }
+bool HorizontalExtent::isPointwise() const {
+  if(auto cartesianExtent = std::get_if<CartesianExtent>(&impl_))
+    return cartesianExtent->isPointwise();
+  if(auto unstructuredExtent = std::get_if<UnstructuredExtent>(&impl_))
+    return unstructuredExtent->isPointwise();
+  return true;
+}
 void HorizontalExtent::limit(HorizontalExtent const& other) {
-  if(impl_ && other.impl_)
-    impl_->limit(*other.impl_);
-  else if(!other.impl_)
+  if(hasType() && other.hasType())
+    apply(other, [](auto& lhs, auto const& rhs) { lhs.limit(rhs); });
+  else if(!other.hasType())
     *this = other;
 }
 
-bool HorizontalExtent::hasType() const { return impl_ != nullptr; }
+bool HorizontalExtent::hasType() const { return !std::holds_alternative<std::monostate>(impl_); }
 
 ast::GridType HorizontalExtent::getType() const {
   DAWN_ASSERT(hasType());
-  if(dynamic_cast<CartesianExtent*>(impl_.get())) {
+  if(std::holds_alternative<CartesianExtent>(impl_)) {
     return ast::GridType::Cartesian;
   } else {
     return ast::GridType::Unstructured;
@@ -23,6 +23,9 @@
 #include <array>
 #include <iosfwd>
 #include <optional>
+#include <type_traits>
+#include <typeinfo>
+#include <variant>
 
 namespace dawn {
 namespace iir {
@@ -68,31 +71,9 @@ Extent operator+(Extent lhs, Extent const& rhs);
 Extent merge(Extent lhs, Extent const& rhs);
 Extent limit(Extent lhs, Extent const& rhs);
 
-class HorizontalExtentImpl {
-public:
-  HorizontalExtentImpl() = default;
-  virtual ~HorizontalExtentImpl() = default;
-
-  HorizontalExtentImpl& operator+=(HorizontalExtentImpl const& other);
-  std::unique_ptr<HorizontalExtentImpl> clone() const;
-
-  void merge(HorizontalExtentImpl const& other);
-  void addCenter();
-  bool operator==(HorizontalExtentImpl const& other) const;
-  bool isPointwise() const;
-  void limit(HorizontalExtentImpl const& other);
-
-protected:
-  virtual void addImpl(HorizontalExtentImpl const& other) = 0;
-  virtual void mergeImpl(HorizontalExtentImpl const& other) = 0;
-  virtual void addCenterImpl() = 0;
-  virtual bool equalsImpl(HorizontalExtentImpl const& other) const = 0;
-  virtual std::unique_ptr<HorizontalExtentImpl> cloneImpl() const = 0;
-  virtual bool isPointwiseImpl() const = 0;
-  virtual void limitImpl(HorizontalExtentImpl const& other) = 0;
-};
-
-class CartesianExtent : public HorizontalExtentImpl {
+/// @brief Horizontal access extent on a cartesian grid
+/// @ingroup optimizer
+class CartesianExtent {
 public:
   CartesianExtent(Extent const& iExtent, Extent const& jExtent);
   CartesianExtent(int iMinus, int iPlus, int jMinus, int jPlus);
@@ -104,41 +85,42 @@ public:
   int jMinus() const;
   int jPlus() const;
 
-protected:
-  void addImpl(HorizontalExtentImpl const& other) override;
-
-  void mergeImpl(HorizontalExtentImpl const& other) override;
-  void addCenterImpl() override;
-  bool equalsImpl(HorizontalExtentImpl const& other) const override;
-  std::unique_ptr<HorizontalExtentImpl> cloneImpl() const override;
-
-  bool isPointwiseImpl() const override;
-  void limitImpl(HorizontalExtentImpl const& other) override;
+  CartesianExtent& operator+=(CartesianExtent const& other);
+  void merge(CartesianExtent const& other);
+  void addCenter();
+  bool operator==(CartesianExtent const& other) const;
+  bool isPointwise() const;
+  void limit(CartesianExtent const& other);
 
 private:
   std::array<Extent, 2> extents_;
 };
 
-class UnstructuredExtent : public HorizontalExtentImpl {
+/// @brief Horizontal access extent on an unstructured grid
+/// @ingroup optimizer
+class UnstructuredExtent {
 public:
   UnstructuredExtent(bool hasExtent);
   UnstructuredExtent();
 
   bool hasExtent() const;
 
-protected:
-  void addImpl(HorizontalExtentImpl const& other) override;
-  void mergeImpl(HorizontalExtentImpl const& other) override;
-  void addCenterImpl() override;
-  bool equalsImpl(HorizontalExtentImpl const& other) const override;
-  std::unique_ptr<HorizontalExtentImpl> cloneImpl() const override;
-  bool isPointwiseImpl() const override;
-  void limitImpl(HorizontalExtentImpl const& other) override;
+  UnstructuredExtent& operator+=(UnstructuredExtent const& other);
+  void merge(UnstructuredExtent const& other);
+  void addCenter();
+  bool operator==(UnstructuredExtent const& other) const;
+  bool isPointwise() const;
+  void limit(UnstructuredExtent const& other);
 
 private:
   bool hasExtent_;
 };
 
+/// @brief Horizontal access extent of either kind of grid
+///
+/// The extent is stored inline, copying and combining extents does not allocate. Combining extents
+/// of different kinds of grids throws `std::bad_cast`.
+/// @ingroup optimizer
 class HorizontalExtent {
 public:
   // the default constructed horizontal extents creates a null-extent that can be compared to all
@@ -153,13 +135,6 @@ public:
   HorizontalExtent(ast::unstructured_);
   HorizontalExtent(ast::unstructured_, bool hasExtent);
 
-  HorizontalExtent(HorizontalExtent const& other);
-  HorizontalExtent(HorizontalExtent&& other) = default;
-  HorizontalExtent& operator=(HorizontalExtent const& other);
-  HorizontalExtent& operator=(HorizontalExtent&& other) = default;
-
-  HorizontalExtent(std::unique_ptr<HorizontalExtentImpl> impl);
-
   template <typename T>
   friend T extent_cast(HorizontalExtent const&);
   template <typename CartFn, typename UnstructuredFn, typename ZeroFn>
@@ -178,7 +153,11 @@ public:
   ast::GridType getType() const;
 
 private:
-  std::unique_ptr<HorizontalExtentImpl> impl_;
+  /// @brief Apply `fn` to the extents of `this` and `other`, which are of the same kind of grid
+  template <typename Fn>
+  void apply(HorizontalExtent const& other, Fn const& fn);
+
+  std::variant<std::monostate, CartesianExtent, UnstructuredExtent> impl_;
 };
 
 /**
@@ -188,11 +167,16 @@ private:
 template <typename T>
 T extent_cast(HorizontalExtent const& extent) {
   using PlainT = std::remove_reference_t<T>;
-  static_assert(std::is_base_of_v<HorizontalExtentImpl, PlainT>,
+  static_assert(std::is_same_v<PlainT, CartesianExtent const> ||
+                    std::is_same_v<PlainT, UnstructuredExtent const>,
                 "Can only be cast to a valid horizontal extent implementation");
   static_assert(std::is_const_v<PlainT>, "Can only be cast to const");
   static PlainT nullExtent{};
-  return extent.impl_ ? dynamic_cast<T>(*extent.impl_) : nullExtent;
+  if(std::holds_alternative<std::monostate>(extent.impl_))
+    return nullExtent;
+  if(auto ptr = std::get_if<std::remove_const_t<PlainT>>(&extent.impl_))
+    return *ptr;
+  throw std::bad_cast();
 }
 
 /**
@@ -215,10 +199,9 @@ auto extent_dispatch(HorizontalExtent const& hExtent, CartFn const& cartFn,
   if(hExtent.isPointwise())
     return zeroFn();
 
-  HorizontalExtentImpl* ptr = hExtent.impl_.get();
-  if(auto cartesianExtent = dynamic_cast<CartesianExtent const*>(ptr)) {
+  if(auto cartesianExtent = std::get_if<CartesianExtent>(&hExtent.impl_)) {
     return cartFn(*cartesianExtent);
-  } else if(auto unstructuredExtent = dynamic_cast<UnstructuredExtent const*>(ptr)) {
+  } else if(auto unstructuredExtent = std::get_if<UnstructuredExtent>(&hExtent.impl_)) {
     return unstructuredFn(*unstructuredExtent);
   } else {
     dawn_unreachable("unknown extent class");
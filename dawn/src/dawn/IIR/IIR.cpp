@@ -15,6 +15,7 @@
 #include "dawn/IIR/IIR.h"
 #include "dawn/IIR/DependencyGraphStage.h"
 #include "dawn/IIR/Field.h"
+#include "dawn/IIR/IIRNodeIterator.h"
 #include "dawn/IIR/Stencil.h"
 #include "dawn/SIR/SIR.h"
 #include "dawn/Support/Assert.h"
@@ -67,6 +68,26 @@ void IIR::updateFromChildren() {
   }
 }
 
+void IIR::updateDoMethodsAndTreeAbove() {
+  for(const auto& doMethod : iterateIIROver<DoMethod>(*this))
+    doMethod->update(NodeUpdateType::level);
+
+  // Bottom to top, nodes without children are left untouched
+  auto updateFromChildrenOf = [](auto& node) {
+    if(node.childrenEmpty())
+      return;
+    node.clearDerivedInfo();
+    node.updateFromChildren();
+  };
+  for(const auto& stage : iterateIIROver<Stage>(*this))
+    updateFromChildrenOf(*stage);
+  for(const auto& multiStage : iterateIIROver<MultiStage>(*this))
+    updateFromChildrenOf(*multiStage);
+  for(const auto& stencil : children_)
+    updateFromChildrenOf(*stencil);
+  updateFromChildrenOf(*this);
+}
+
 void IIR::DerivedInfo::clear() { fields_.clear(); }
 
 json::json IIR::jsonDump() const {
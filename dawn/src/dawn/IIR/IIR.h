@@ -72,6 +72,12 @@ public:
   /// @brief update the derived info from children
   virtual void updateFromChildren() override;
 
+  /// @brief update the derived info of all the do-methods and of the tree above them
+  ///
+  /// Equivalent to updating each do-method with `NodeUpdateType::levelAndTreeAbove`, but every
+  /// node above the do-methods is updated only once.
+  void updateDoMethodsAndTreeAbove();
+
   /// @brief returns true if the accessid is used within the stencil
   bool hasFieldAccessID(const int accessID) const { return derivedInfo_.fields_.count(accessID); }
 
@@ -159,15 +159,14 @@ bool Stage::overlaps(const Interval& interval, const std::unordered_map<int, Fie
 
     for(const auto& thisFieldPair : getFields()) {
       const Field& thisField = thisFieldPair.second;
-      for(const auto& fieldPair : fields) {
-        const Field& field = fieldPair.second;
-        if(thisField.getAccessID() != field.getAccessID())
-          continue;
-
-        if(thisInterval.extendInterval(thisField.getExtents().verticalExtent())
-               .overlaps(interval.extendInterval(field.getExtents().verticalExtent())))
-          return true;
-      }
+      auto fieldIt = fields.find(thisField.getAccessID());
+      if(fieldIt == fields.end())
+        continue;
+
+      const Field& field = fieldIt->second;
+      if(thisInterval.extendInterval(thisField.getExtents().verticalExtent())
+             .overlaps(interval.extendInterval(field.getExtents().verticalExtent())))
+        return true;
     }
   }
 
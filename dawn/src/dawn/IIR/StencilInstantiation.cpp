@@ -319,19 +319,19 @@ void StencilInstantiation::reportAccesses() const {
 
 void StencilInstantiation::computeDerivedInfo() {
   // Update doMethod node types
-  for(const auto& doMethod : iterateIIROver<iir::DoMethod>(*(this->getIIR()))) {
-    doMethod->update(iir::NodeUpdateType::levelAndTreeAbove);
-  }
+  getIIR()->updateDoMethodsAndTreeAbove();
 
   // Compute stage extents
   for(const auto& stencilPtr : this->getStencils()) {
-    iir::Stencil& stencil = *stencilPtr;
-
-    int numStages = stencil.getNumStages();
+    // Stencil::getStage(int) is linear in the number of stages, collect them once
+    std::vector<iir::Stage*> stages;
+    for(const auto& stage : iterateIIROver<iir::Stage>(*stencilPtr))
+      stages.push_back(stage.get());
+    int numStages = stages.size();
 
     // backward loop over stages
     for(int i = numStages - 1; i >= 0; --i) {
-      iir::Stage& fromStage = *(stencil.getStage(i));
+      iir::Stage& fromStage = *stages[i];
       // If the stage has a global iterationspace set, we should never extend it since it is user
       // defined where this computation should happen
       if(std::any_of(fromStage.getIterationSpace().cbegin(), fromStage.getIterationSpace().cend(),
@@ -359,18 +359,13 @@ void StencilInstantiation::computeDerivedInfo() {
 
         // check which (previous) stage computes the field (read in fromStage)
         for(int j = i - 1; j >= 0; --j) {
-          iir::Stage& toStage = *(stencil.getStage(j));
+          iir::Stage& toStage = *stages[j];
           // ===---------------------------------------------------------------------------------===
           //      Point two [ExtentComputationTODO]
           // ===---------------------------------------------------------------------------------===
-          auto fields = toStage.getFields();
-          auto it = std::find_if(fields.begin(), fields.end(),
-                                 [&](std::pair<int, iir::Field> const& pair) {
-                                   const auto& f = pair.second;
-                                   return (f.getIntend() != iir::Field::IntendKind::Input) &&
-                                          (f.getAccessID() == fromField.getAccessID());
-                                 });
-          if(it == fields.end())
+          const auto& fields = toStage.getFields();
+          auto it = fields.find(fromField.getAccessID());
+          if(it == fields.end() || it->second.getIntend() == iir::Field::IntendKind::Input)
             continue;
 
           // if found, add the (read) extent of the field as an extent of the stage
@@ -26,8 +26,11 @@
 #include "dawn/Optimizer/PassTemporaryType.h"
 #include "dawn/Optimizer/StatementMapper.h"
 #include "dawn/SIR/SIR.h"
+#include "dawn/Support/Format.h"
+#include "dawn/Support/Json.h"
 #include "dawn/Support/Logging.h"
 #include "dawn/Support/STLExtras.h"
+#include <fstream>
 #include <stack>
 
 namespace dawn {
@@ -594,6 +597,43 @@ public:
 };
 } // namespace
 
+void HardwareConfig::readJSON(const std::string& filename) {
+  std::ifstream ifs(filename);
+  if(!ifs.is_open())
+    throw std::runtime_error(
+        dawn::format("cannot read hardware configuration: failed to open file \"%s\"", filename));
+
+  json::json config;
+  try {
+    ifs >> config;
+    for(const auto& [key, value] : config.items()) {
+#define HARDWARE_CONFIG_MEMBER(NAME)                                                               \
+  if(key == #NAME) {                                                                               \
+    NAME = value.get<decltype(NAME)>();                                                            \
+    continue;                                                                                      \
+  }
+      HARDWARE_CONFIG_MEMBER(SMemMaxFields)
+      HARDWARE_CONFIG_MEMBER(TexCacheMaxFields)
+      HARDWARE_CONFIG_MEMBER(FloatSize)
+      HARDWARE_CONFIG_MEMBER(L1CacheSize)
+      HARDWARE_CONFIG_MEMBER(L2CacheSize)
+      HARDWARE_CONFIG_MEMBER(LLCSize)
+      HARDWARE_CONFIG_MEMBER(CacheLineSize)
+      HARDWARE_CONFIG_MEMBER(L1Bandwidth)
+      HARDWARE_CONFIG_MEMBER(L2Bandwidth)
+      HARDWARE_CONFIG_MEMBER(LLCBandwidth)
+      HARDWARE_CONFIG_MEMBER(DRAMBandwidth)
+      HARDWARE_CONFIG_MEMBER(FlopRate)
+#undef HARDWARE_CONFIG_MEMBER
+      throw std::runtime_error(dawn::format(
+          "cannot read hardware configuration \"%s\": unknown member \"%s\"", filename, key));
+    }
+  } catch(const json::json::exception& e) {
+    throw std::runtime_error(
+        dawn::format("cannot read hardware configuration \"%s\": %s", filename, e.what()));
+  }
+}
+
 OptimizerContext::OptimizerContext(DiagnosticsEngine& diagnostics, OptimizerContextOptions options,
                                    const std::shared_ptr<SIR>& SIR)
     : diagnostics_(diagnostics), options_(options), SIR_(SIR) {
@@ -20,6 +20,7 @@
 #include "dawn/Support/NonCopyable.h"
 #include <map>
 #include <memory>
+#include <string>
 
 namespace dawn {
 
@@ -32,13 +33,41 @@ class StencilInstantiation;
 }
 
 class DawnCompiler;
+class PassProfiler;
 
+/// @brief Model of the target hardware used by the cost models of the optimizer
+///
+/// The GPU members describe a single streaming multiprocessor, the CPU members the memory hierarchy
+/// as seen by a single core.
 struct HardwareConfig {
   /// Maximum number of fields concurrently in shared memory
   int SMemMaxFields = 8;
 
   /// Maximum number of fields concurrently in the texture cache
   int TexCacheMaxFields = 3;
+
+  /// Size of a floating point value, in bytes
+  int FloatSize = 8;
+
+  /// @name CPU memory hierarchy (sizes in bytes, bandwidths in GB/s)
+  /// @{
+  std::size_t L1CacheSize = 32 * 1024;
+  std::size_t L2CacheSize = 1024 * 1024;
+  std::size_t LLCSize = 32 * 1024 * 1024;
+  int CacheLineSize = 64;
+  double L1Bandwidth = 200;
+  double L2Bandwidth = 100;
+  double LLCBandwidth = 50;
+  double DRAMBandwidth = 20;
+  /// @}
+
+  /// Arithmetic throughput of a single core, in GFlop/s
+  double FlopRate = 16;
+
+  /// @brief Read the members given in the JSON file `filename`, e.g `{"LLCSize": 16777216}`, the
+  /// other members keep their values
+  /// @throws std::runtime_error if the file cannot be read or contains unknown members
+  void readJSON(const std::string& filename);
 };
 
 /// @brief Context of handling all Optimizations
@@ -62,6 +91,7 @@ private:
   std::map<std::string, std::shared_ptr<iir::StencilInstantiation>> stencilInstantiationMap_;
   PassManager passManager_;
   HardwareConfig hardwareConfiguration_;
+  PassProfiler* passProfiler_ = nullptr;
 
   void fillIIR();
 
@@ -102,6 +132,12 @@ public:
   const HardwareConfig& getHardwareConfiguration() const { return hardwareConfiguration_; }
   HardwareConfig& getHardwareConfiguration() { return hardwareConfiguration_; }
 
+  /// @brief Get the profiler recording the pass runs (`nullptr` if passes are not profiled)
+  PassProfiler* getPassProfiler() const { return passProfiler_; }
+
+  /// @brief Profile the passes run in this context with `profiler` (does @b not take ownership)
+  void setPassProfiler(PassProfiler* profiler) { passProfiler_ = profiler; }
+
   /// @brief Create a new pass at the end of the pass list
   template <class T, typename... Args>
   void pushBackPass(Args&&... args) {
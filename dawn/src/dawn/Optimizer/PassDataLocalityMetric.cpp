@@ -21,6 +21,7 @@
 #include "dawn/Optimizer/OptimizerContext.h"
 #include "dawn/Support/Format.h"
 #include "dawn/Support/StringUtil.h"
+#include <cmath>
 #include <deque>
 #include <stack>
 #include <unordered_map>
@@ -300,6 +301,68 @@ computeReadWriteAccessesMetric(const std::shared_ptr<iir::StencilInstantiation>&
   return std::make_pair(readWriteCounter.getNumReads(), readWriteCounter.getNumWrites());
 }
 
+double computeDRAMBytesPerPoint(const OptimizerContext& context,
+                                const iir::MultiStage& multiStage) {
+  const HardwareConfig& config = context.getHardwareConfiguration();
+  const auto& options = context.getOptions();
+  const double sizeI = options.DomainSizeI > 0 ? options.DomainSizeI : 128;
+  const double sizeJ = options.DomainSizeJ > 0 ? options.DomainSizeJ : 128;
+  const double sizeK = options.DomainSizeK > 0 ? options.DomainSizeK : 80;
+
+  struct AccessedRegion {
+    int WidthI, WidthJ, WidthK;
+  };
+  auto getAccessedRegion = [](const iir::Extents& extents) {
+    auto const& hExtent = iir::extent_cast<iir::CartesianExtent const&>(extents.horizontalExtent());
+    auto const& vExtent = extents.verticalExtent();
+    return AccessedRegion{hExtent.iPlus() - hExtent.iMinus(), hExtent.jPlus() - hExtent.jMinus(),
+                          vExtent.plus() - vExtent.minus()};
+  };
+
+  // Working sets which have to stay in the caches to reuse the loaded rows and planes
+  double rowsBytes = 0, planesBytes = 0;
+  std::vector<const iir::Field*> fields;
+  for(const auto& AccessIDFieldPair : multiStage.getFields()) {
+    auto cacheIt = multiStage.getCaches().find(AccessIDFieldPair.first);
+    if(cacheIt != multiStage.getCaches().end() &&
+       cacheIt->second.getIOPolicy() == iir::Cache::IOPolicy::local)
+      continue;
+
+    const iir::Field& field = AccessIDFieldPair.second;
+    AccessedRegion region = getAccessedRegion(field.getExtentsRB());
+    rowsBytes += (region.WidthJ + 1) * (sizeI + region.WidthI) * config.FloatSize;
+    planesBytes += (region.WidthK + 1) * (sizeI + region.WidthI) * (sizeJ + region.WidthJ) *
+                   config.FloatSize;
+    fields.push_back(&field);
+  }
+  const bool rowsFit = rowsBytes <= config.L2CacheSize;
+  const bool planesFit = planesBytes <= config.LLCSize;
+
+  // Bytes moved per grid point to sweep once over the region accessed with the given extents
+  auto getBytesPerPoint = [&](const iir::Extents& extents) {
+    AccessedRegion region = getAccessedRegion(extents);
+    double rowBytes =
+        std::ceil((sizeI + region.WidthI) * config.FloatSize / config.CacheLineSize) *
+        config.CacheLineSize;
+    return rowBytes / sizeI * (sizeJ + region.WidthJ) / sizeJ * (sizeK + region.WidthK) / sizeK;
+  };
+
+  double bytes = 0;
+  for(const iir::Field* field : fields) {
+    const auto& readExtents = field->getReadExtentsRB();
+    const auto& writeExtents = field->getWriteExtentsRB();
+
+    if(readExtents) {
+      AccessedRegion region = getAccessedRegion(*readExtents);
+      bytes += getBytesPerPoint(*readExtents) * (rowsFit ? 1 : region.WidthJ + 1) *
+               (planesFit ? 1 : region.WidthK + 1);
+    }
+    if(writeExtents)
+      bytes += getBytesPerPoint(*writeExtents) * (readExtents ? 1 : 2);
+  }
+  return bytes;
+}
+
 PassDataLocalityMetric::PassDataLocalityMetric(OptimizerContext& context)
     : Pass(context, "PassDataLocalityMetric") {}
 
@@ -313,6 +376,9 @@ bool PassDataLocalityMetric::run(
               << std::string((paddingLength + 1) / 2, '-') << "\n";
 
     std::size_t perStencilNumReads = 0, perStencilNumWrites = 0;
+    double perStencilDRAMBytes = 0;
+    const bool isCartesian =
+        stencilInstantiation->getIIR()->getGridType() == ast::GridType::Cartesian;
 
     int stencilIdx = 0;
     for(const auto& stencilPtr : stencilInstantiation->getStencils()) {
@@ -333,6 +399,11 @@ bool PassDataLocalityMetric::run(
 
         std::cout << format("    %-20s %15i\n", "Reads", numReads);
         std::cout << format("    %-20s %15i\n", "Writes", numWrites);
+        if(isCartesian) {
+          double dramBytes = computeDRAMBytesPerPoint(context_, multiStage);
+          std::cout << format("    %-20s %15.1f\n", "DRAM bytes/point", dramBytes);
+          perStencilDRAMBytes += dramBytes;
+        }
 
         perStencilNumReads += numReads;
         perStencilNumWrites += numWrites;
@@ -345,6 +416,8 @@ bool PassDataLocalityMetric::run(
     std::cout << format("\n  %-22s %15s\n", "", std::string(15, '='));
     std::cout << format("  %-22s %15i\n", "Reads", perStencilNumReads);
     std::cout << format("  %-22s %15i\n", "Writes", perStencilNumWrites);
+    if(isCartesian)
+      std::cout << format("  %-22s %15.1f\n", "DRAM bytes/point", perStencilDRAMBytes);
     std::cout << std::string(51, '-') << std::endl;
   }
 
@@ -51,6 +51,17 @@ std::unordered_map<int, ReadWriteAccumulator> computeReadWriteAccessesMetricPerA
     const std::shared_ptr<iir::StencilInstantiation>& instantiation, OptimizerContext& context,
     const iir::MultiStage& multiStage);
 
+/// @brief Predict the bytes a CPU core moves between DRAM and its caches per grid point of the
+/// (cartesian) multi-stage
+///
+/// The domain (of the size given by the options, or 128x128x80) is swept plane by plane, row by
+/// row. Accesses at different j (or k) offsets are served by the cache as long as the rows (or
+/// planes) spanned by the extents of all fields fit into the L2 (or last-level) cache, otherwise
+/// each offset loads the field again. Rows are moved in whole cache lines, stores to fields which
+/// are not read first cost an additional line fill (write-allocate) and fields in local caches
+/// never leave the caches.
+double computeDRAMBytesPerPoint(const OptimizerContext& context, const iir::MultiStage& multiStage);
+
 } // namespace dawn
 
 #endif
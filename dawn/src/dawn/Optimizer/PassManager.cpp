@@ -16,6 +16,7 @@
 #include "dawn/AST/GridType.h"
 #include "dawn/IIR/StencilInstantiation.h"
 #include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassProfiler.h"
 #include "dawn/Support/Exception.h"
 #include "dawn/Support/Logging.h"
 #include <vector>
@@ -49,7 +50,14 @@ bool PassManager::runPassOnStencilInstantiation(
     Pass* pass) {
   DAWN_LOG(INFO) << "Starting " << pass->getName() << " ...";
 
-  if(!pass->run(instantiation)) {
+  PassProfiler* profiler = context.getPassProfiler();
+  const PassProfiler::Mark begin = profiler ? PassProfiler::mark() : PassProfiler::Mark{};
+  const bool succeeded = pass->run(instantiation);
+  if(profiler)
+    profiler->record(pass->getName(), instantiation->getName(), passCounter_[pass->getName()],
+                     begin);
+
+  if(!succeeded) {
     DAWN_LOG(WARNING) << "Done with " << pass->getName() << " : FAIL";
     return false;
   }
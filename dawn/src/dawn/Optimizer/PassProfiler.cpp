@@ -0,0 +1,132 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/Optimizer/PassProfiler.h"
+#include "dawn/Support/Format.h"
+#include "dawn/Support/Json.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <ostream>
+#include <sys/resource.h>
+
+namespace dawn {
+
+namespace {
+
+struct Accumulated {
+  int Calls = 0;
+  double Duration = 0;
+  long PeakRSSDelta = 0;
+};
+
+void printTable(std::ostream& os, const std::string& title,
+                const std::vector<std::pair<std::string, Accumulated>>& rows, double totalTime) {
+  std::size_t width = title.size();
+  for(const auto& row : rows)
+    width = std::max(width, row.first.size());
+  const int w = width;
+
+  os << format("%-*s %7s %12s %7s %14s\n", w, title.c_str(), "calls", "time [ms]", "%",
+               "peak RSS [kB]");
+  for(const auto& [name, acc] : rows)
+    os << format("%-*s %7i %12.3f %6.1f%% %14li\n", w, name.c_str(), acc.Calls,
+                 acc.Duration / 1000, totalTime > 0 ? 100 * acc.Duration / totalTime : 0.0,
+                 acc.PeakRSSDelta);
+}
+
+} // namespace
+
+PassProfiler::PassProfiler() : origin_(std::chrono::steady_clock::now()) {}
+
+PassProfiler::Mark PassProfiler::mark() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  // bytes on macOS, kilobytes elsewhere
+  usage.ru_maxrss /= 1024;
+#endif
+  return Mark{std::chrono::steady_clock::now(), usage.ru_maxrss};
+}
+
+void PassProfiler::record(const std::string& passName, const std::string& stencilName,
+                          int invocation, const Mark& begin) {
+  const Mark end = mark();
+  using Microseconds = std::chrono::duration<double, std::micro>;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const int thread = threads_.emplace(std::this_thread::get_id(), threads_.size()).first->second;
+  events_.push_back(Event{passName, stencilName, invocation,
+                          Microseconds(begin.Time - origin_).count(),
+                          Microseconds(end.Time - begin.Time).count(),
+                          end.PeakRSS - begin.PeakRSS, thread});
+}
+
+void PassProfiler::printSummary(std::ostream& os) const {
+  // Passes in the order of their first run, instantiations in alphabetical order
+  std::vector<std::pair<std::string, Accumulated>> passes;
+  std::map<std::string, Accumulated> stencils;
+  double totalTime = 0;
+
+  for(const Event& event : events_) {
+    auto it = std::find_if(passes.begin(), passes.end(),
+                           [&](const auto& pass) { return pass.first == event.PassName; });
+    if(it == passes.end())
+      it = passes.emplace(passes.end(), event.PassName, Accumulated{});
+
+    for(Accumulated* acc : {&it->second, &stencils[event.StencilName]}) {
+      acc->Calls++;
+      acc->Duration += event.Duration;
+      acc->PeakRSSDelta += event.PeakRSSDelta;
+    }
+    totalTime += event.Duration;
+  }
+
+  os << "===-------------------------------------------------------------------------===\n"
+     << "                             Pass execution timing\n"
+     << "===-------------------------------------------------------------------------===\n";
+  printTable(os, "pass", passes, totalTime);
+  os << "\n";
+  printTable(os, "stencil instantiation", {stencils.begin(), stencils.end()}, totalTime);
+  os << format("\ntotal: %.3f ms in %i pass runs\n", totalTime / 1000, int(events_.size()));
+}
+
+bool PassProfiler::writeTrace(const std::string& filename) const {
+  std::ofstream fs(filename, std::ios::out | std::ios::trunc);
+  if(!fs.is_open())
+    return false;
+
+  json::json trace;
+  trace["displayTimeUnit"] = "ms";
+  trace["traceEvents"] = json::json::array();
+  for(const Event& event : events_) {
+    json::json node;
+    node["name"] = event.PassName;
+    node["cat"] = event.StencilName;
+    node["ph"] = "X";
+    node["ts"] = event.Start;
+    node["dur"] = event.Duration;
+    node["pid"] = 0;
+    node["tid"] = event.Thread;
+    node["args"]["stencil"] = event.StencilName;
+    node["args"]["invocation"] = event.Invocation;
+    node["args"]["peakRSSDelta_kB"] = event.PeakRSSDelta;
+    trace["traceEvents"].push_back(node);
+  }
+  fs << trace.dump(2) << std::endl;
+  fs.close();
+  return !fs.fail();
+}
+
+} // namespace dawn
@@ -0,0 +1,84 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#ifndef DAWN_OPTIMIZER_PASSPROFILER_H
+#define DAWN_OPTIMIZER_PASSPROFILER_H
+
+#include "dawn/Support/NonCopyable.h"
+#include <chrono>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace dawn {
+
+/// @brief Records wall time and growth of the peak resident set size of every pass run
+///
+/// Each run of a pass on a stencil instantiation is one event, identified by the name of the pass,
+/// the name of the instantiation and the invocation count of the pass in its `PassManager`.
+/// Recording is thread-safe. The peak resident set size is a property of the whole process, hence
+/// the memory figures of passes running concurrently on several threads overlap.
+///
+/// @ingroup optimizer
+class PassProfiler : NonCopyable {
+public:
+  /// @brief Snapshot of the clock and the peak resident set size
+  struct Mark {
+    std::chrono::steady_clock::time_point Time;
+    long PeakRSS; ///< In kilobytes
+  };
+
+  struct Event {
+    std::string PassName;
+    std::string StencilName;
+    int Invocation;
+    double Start;    ///< Microseconds since the creation of the profiler
+    double Duration; ///< Microseconds
+    long PeakRSSDelta;
+    int Thread;
+  };
+
+  PassProfiler();
+
+  /// @brief Take a snapshot before running a pass
+  static Mark mark();
+
+  /// @brief Record the run of a pass which started at `begin` and ended now
+  void record(const std::string& passName, const std::string& stencilName, int invocation,
+              const Mark& begin);
+
+  /// @brief Get the recorded events in the order they ended
+  const std::vector<Event>& getEvents() const { return events_; }
+
+  /// @brief Print the time, number of calls and peak resident set size growth accumulated per pass
+  /// and per stencil instantiation
+  void printSummary(std::ostream& os) const;
+
+  /// @brief Write the events in the Chrome trace-event format (chrome://tracing or Perfetto)
+  /// @returns `false` if `filename` cannot be written
+  bool writeTrace(const std::string& filename) const;
+
+private:
+  std::chrono::steady_clock::time_point origin_;
+  std::mutex mutex_;
+  std::vector<Event> events_;
+  std::unordered_map<std::thread::id, int> threads_;
+};
+
+} // namespace dawn
+
+#endif
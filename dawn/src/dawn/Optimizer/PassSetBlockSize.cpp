@@ -18,54 +18,178 @@
 #include "dawn/Optimizer/OptimizerContext.h"
 #include "dawn/Support/Array.h"
 #include <algorithm>
+#include <tuple>
+#include <vector>
 
 namespace dawn {
 
-PassSetBlockSize::PassSetBlockSize(OptimizerContext& context) : Pass(context, "PassSetBlockSize") {}
+namespace {
 
-bool PassSetBlockSize::run(const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) {
-  const auto& IIR = stencilInstantiation->getIIR();
+/// Candidate block sizes of the cost model. The k block size is not modelled, the CPU backends
+/// compute all the levels of a block before moving on to the next one (see `getFieldWorkingSet`).
+const std::vector<unsigned int> candidateBlockSizesI = {8, 16, 32, 64, 128, 256, 512};
+const std::vector<unsigned int> candidateBlockSizesJ = {1, 2, 4, 8, 16, 32, 64, 128};
+constexpr unsigned int blockSizeK = 4;
 
-  Array3ui blockSize{static_cast<unsigned int>(context_.getOptions().BlockSizeI),
-                     static_cast<unsigned int>(context_.getOptions().BlockSizeJ),
-                     static_cast<unsigned int>(context_.getOptions().BlockSizeK)};
-  if(std::all_of(blockSize.begin(), blockSize.end(), [](unsigned int size) { return size == 0; })) {
-    bool verticalPattern = true;
-    for(const auto& stage : iterateIIROver<iir::Stage>(*IIR)) {
-      if(!stage->getExtents().isHorizontalPointwise()) {
-        verticalPattern = false;
-      }
-    }
-    for(const auto& stencil : (*IIR).getChildren()) {
-      for(const auto& fieldP : stencil->getFields()) {
-        const auto& field = fieldP.second;
+struct BlockSizeCost {
+  Array3ui BlockSize;
+  double Traffic;             ///< Predicted main memory traffic per grid point, in bytes
+  std::size_t WorkingSet;     ///< Bytes a block keeps in the cache (see `getFieldWorkingSet`)
+  std::size_t LocalCacheSize; ///< Bytes of the buffers of the local caches of a block
+};
+
+/// Number of grid points in i and j the given extents add to a block
+std::array<int, 2> getHaloWidths(const iir::Extents& extents) {
+  return iir::extent_dispatch(
+      extents.horizontalExtent(),
+      [](const iir::CartesianExtent& hExtent) {
+        return std::array<int, 2>{hExtent.iPlus() - hExtent.iMinus(),
+                                  hExtent.jPlus() - hExtent.jMinus()};
+      },
+      [](const iir::UnstructuredExtent&) { return std::array<int, 2>{0, 0}; },
+      []() { return std::array<int, 2>{0, 0}; });
+}
+
+/// Bytes of the cache lines a block loads (or stores) on one vertical level when accessing a field
+/// with the given extents. Rows of the block which do not fill whole cache lines waste the rest.
+std::size_t getBlockBytes(const Array3ui& blockSize, const iir::Extents& extents,
+                          const HardwareConfig& config) {
+  auto widths = getHaloWidths(extents);
+  const std::size_t rowBytes = (blockSize[0] + widths[0]) * config.FloatSize;
+  const std::size_t rowLines = (rowBytes + config.CacheLineSize - 1) / config.CacheLineSize;
+  return rowLines * config.CacheLineSize * (blockSize[1] + widths[1]);
+}
+
+/// @brief Estimate the main memory traffic and the cache footprint of the stencils if they are
+/// computed with blocks of size `blockSize`
+///
+/// The CPU backends compute all stages of a multi-stage on a block, level by level. The fields
+/// accessed on a level (including their redundant computations and vertical accesses) form the
+/// working set of the block, which has to stay in the L2 cache to be reused by the stages. Every
+/// field is then loaded (or stored) once per block on the points of the block extended by the read
+/// (or write) extents of the field, hence the halos are loaded again by the neighbouring blocks.
+/// Fields in local caches live in buffers of the block, which should stay in the L1 cache, and
+/// never hit the main memory.
+BlockSizeCost computeCost(const iir::IIR& IIR, const Array3ui& blockSize,
+                          const HardwareConfig& config) {
+  const double blockPoints = blockSize[0] * blockSize[1];
+  BlockSizeCost cost{blockSize, 0, 0, 0};
+
+  for(const auto& multiStage : iterateIIROver<iir::MultiStage>(IIR)) {
+    const auto& caches = multiStage->getCaches();
+    std::size_t workingSet = 0;
+    std::size_t localCacheSize = 0;
 
-        auto extent = field.field.getExtentsRB();
-        auto const& hExtent =
-            dawn::iir::extent_cast<dawn::iir::CartesianExtent const&>(extent.horizontalExtent());
+    for(const auto& fieldPair : multiStage->getFields()) {
+      const iir::Field& field = fieldPair.second;
+      const std::size_t bytes =
+          PassSetBlockSize::getFieldWorkingSet(blockSize, field.getExtentsRB(), config);
+      workingSet += bytes;
 
-        if(hExtent.jPlus() != 0 || hExtent.jMinus() != 0) {
-          verticalPattern = false;
-        }
+      auto cacheIt = caches.find(field.getAccessID());
+      if(cacheIt != caches.end() && cacheIt->second.getIOPolicy() == iir::Cache::IOPolicy::local) {
+        localCacheSize += bytes;
+        continue;
       }
+
+      if(field.getReadExtentsRB())
+        cost.Traffic += getBlockBytes(blockSize, *field.getReadExtentsRB(), config) / blockPoints;
+      if(field.getWriteExtentsRB())
+        cost.Traffic += getBlockBytes(blockSize, *field.getWriteExtentsRB(), config) / blockPoints;
     }
+    cost.WorkingSet = std::max(cost.WorkingSet, workingSet);
+    cost.LocalCacheSize = std::max(cost.LocalCacheSize, localCacheSize);
+  }
+  return cost;
+}
 
-    // recent generation of GPU architectures show good memory bandwidth with <32,1> block sizes,
-    // but if there are horizontal data dependencies, the redundant accesses across different blocks
-    // limit the performance
-    if(verticalPattern) {
-      blockSize = {32, 1, 4};
-    } else {
-      blockSize = {32, 4, 4};
+/// @brief Default block size of the GPU backends
+///
+/// Recent generation of GPU architectures show good memory bandwidth with <32,1> block sizes, but
+/// if there are horizontal data dependencies, the redundant accesses across different blocks limit
+/// the performance.
+Array3ui getDefaultBlockSize(const iir::IIR& IIR) {
+  bool verticalPattern = true;
+  for(const auto& stage : iterateIIROver<iir::Stage>(IIR)) {
+    if(!stage->getExtents().isHorizontalPointwise()) {
+      verticalPattern = false;
     }
   }
+  for(const auto& stencil : IIR.getChildren()) {
+    for(const auto& fieldP : stencil->getFields()) {
+      const auto& field = fieldP.second;
+
+      auto extent = field.field.getExtentsRB();
+      auto const& hExtent =
+          dawn::iir::extent_cast<dawn::iir::CartesianExtent const&>(extent.horizontalExtent());
+
+      if(hExtent.jPlus() != 0 || hExtent.jMinus() != 0) {
+        verticalPattern = false;
+      }
+    }
+  }
+  return verticalPattern ? Array3ui{32, 1, 4} : Array3ui{32, 4, 4};
+}
+
+/// @brief Choose the block size with the least predicted traffic among the ones whose working set
+/// fits into the L2 cache and whose local caches fit into the L1 cache
+///
+/// If no block size fits, the one exceeding the caches the least is chosen. Among equally expensive
+/// block sizes, the longest rows (which vectorize best) and then the smallest working set win.
+Array3ui getCostModelBlockSize(const iir::IIR& IIR, const HardwareConfig& config) {
+  auto overflow = [](std::size_t size, std::size_t capacity) {
+    return size > capacity ? size - capacity : 0;
+  };
+  auto rank = [&](const BlockSizeCost& cost) {
+    return std::make_tuple(overflow(cost.WorkingSet, config.L2CacheSize),
+                           overflow(cost.LocalCacheSize, config.L1CacheSize), cost.Traffic,
+                           -int(cost.BlockSize[0]), cost.WorkingSet);
+  };
+
+  std::vector<BlockSizeCost> candidates;
+  for(unsigned int sizeJ : candidateBlockSizesJ)
+    for(unsigned int sizeI : candidateBlockSizesI)
+      candidates.push_back(computeCost(IIR, {sizeI, sizeJ, blockSizeK}, config));
+  return std::min_element(
+             candidates.begin(), candidates.end(),
+             [&](const BlockSizeCost& a, const BlockSizeCost& b) { return rank(a) < rank(b); })
+      ->BlockSize;
+}
+
+} // anonymous namespace
+
+PassSetBlockSize::PassSetBlockSize(OptimizerContext& context) : Pass(context, "PassSetBlockSize") {}
+
+Array3ui PassSetBlockSize::computeBlockSize(const iir::IIR& IIR, const OptimizerContext& context) {
+  Array3ui blockSize{static_cast<unsigned int>(context.getOptions().BlockSizeI),
+                     static_cast<unsigned int>(context.getOptions().BlockSizeJ),
+                     static_cast<unsigned int>(context.getOptions().BlockSizeK)};
+  if(std::all_of(blockSize.begin(), blockSize.end(), [](unsigned int size) { return size == 0; }))
+    blockSize = context.getOptions().BlockSizeCostModel
+                    ? getCostModelBlockSize(IIR, context.getHardwareConfiguration())
+                    : getDefaultBlockSize(IIR);
+  return blockSize;
+}
+
+std::size_t PassSetBlockSize::getFieldWorkingSet(const Array3ui& blockSize,
+                                                 const iir::Extents& extents,
+                                                 const HardwareConfig& config) {
+  const auto& vExtent = extents.verticalExtent();
+  return getBlockBytes(blockSize, extents, config) * (1 + vExtent.plus() - vExtent.minus());
+}
+
+bool PassSetBlockSize::run(const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) {
+  const auto& IIR = stencilInstantiation->getIIR();
+  const HardwareConfig& config = context_.getHardwareConfiguration();
 
+  const Array3ui blockSize = computeBlockSize(*IIR, context_);
   IIR->setBlockSize(blockSize);
 
   if(context_.getOptions().ReportPassSetBlockSize) {
     std::cout << "\nPASS: " << getName() << ": " << stencilInstantiation->getName() << ": blockSize"
               << "[" << blockSize[0] << "," << blockSize[1] << "," << blockSize[2] << "]"
-              << std::endl;
+              << ", predicted traffic " << computeCost(*IIR, blockSize, config).Traffic
+              << " bytes per grid point" << std::endl;
   }
 
   // Notice that gridtools does not supported yet setting different block sizes, therefore the block
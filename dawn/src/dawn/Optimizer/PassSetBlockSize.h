@@ -16,12 +16,28 @@
 #define DAWN_OPTIMIZER_PASSSETBLOCKSIZE_H
 
 #include "dawn/Optimizer/Pass.h"
+#include "dawn/Support/Array.h"
+#include <cstddef>
 
 namespace dawn {
 
+struct HardwareConfig;
+
+namespace iir {
+class Extents;
+class IIR;
+} // namespace iir
+
 /// @brief This Pass computes and assign the block size of each IIR
 ///
-/// This Pass depends on `PassSetBlockSize`.
+/// Unless the block size is given by the options, it defaults to {32,1,4} for horizontally
+/// pointwise stencils and to {32,4,4} otherwise. With `-block-size-cost-model` it is chosen by a
+/// model of the CPU caches instead: the working set of a block has to fit into
+/// `HardwareConfig::L2CacheSize`, its local caches into `HardwareConfig::L1CacheSize`, and the main
+/// memory traffic, which grows with the accesses of halos by neighbouring blocks and with partially
+/// used cache lines, is minimized.
+///
+/// This Pass depends on `PassSetCaches`.
 ///
 /// @ingroup optimizer
 ///
@@ -32,6 +48,19 @@ public:
 
   /// @brief Pass implementation
   bool run(const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) override;
+
+  /// @brief Compute the block size this pass assigns to `IIR` in the given `context`
+  static Array3ui computeBlockSize(const iir::IIR& IIR, const OptimizerContext& context);
+
+  /// @brief Bytes a block of size `blockSize` keeps in the cache for a field accessed with
+  /// `extents`, i.e the cache lines of the block extended by the extents on all levels reused
+  ///
+  /// The CPU backends compute all levels of a block before moving on to the next block, hence only
+  /// the levels within the vertical extent are reused and the k size of the block does not matter.
+  /// The sum over the fields of a multi-stage is its working set, which the cost model of this pass
+  /// and `PassStencilSplitter` keep within `HardwareConfig::L2CacheSize`.
+  static std::size_t getFieldWorkingSet(const Array3ui& blockSize, const iir::Extents& extents,
+                                        const HardwareConfig& config);
 };
 
 } // namespace dawn
@@ -25,8 +25,6 @@ bool PassSetDependencyGraph::run(
     const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) {
   const auto& IIR = stencilInstantiation->getIIR();
   for(const auto& doMethod : iterateIIROver<iir::DoMethod>(*IIR)) {
-    // and do the update of the Graphs
-    doMethod->update(iir::NodeUpdateType::levelAndTreeAbove);
     iir::DependencyGraphAccesses newGraph(stencilInstantiation->getMetaData());
     // Build the Dependency graph (bottom to top)
     for(int stmtIndex = doMethod->getAST().getStatements().size() - 1; stmtIndex >= 0;
@@ -36,9 +34,9 @@ bool PassSetDependencyGraph::run(
       newGraph.insertStatement(stmt);
     }
     doMethod->setDependencyGraph(std::move(newGraph));
-    // and do the update
-    doMethod->update(iir::NodeUpdateType::levelAndTreeAbove);
   }
+  // and do the update
+  IIR->updateDoMethodsAndTreeAbove();
   return true;
 }
 } // namespace dawn
@@ -14,6 +14,7 @@
 
 #include "dawn/Optimizer/PassSetStageGraph.h"
 #include "dawn/IIR/DependencyGraphStage.h"
+#include "dawn/IIR/IIRNodeIterator.h"
 #include "dawn/IIR/StencilInstantiation.h"
 #include "dawn/Optimizer/OptimizerContext.h"
 #include "dawn/Support/STLExtras.h"
@@ -26,31 +27,30 @@ static bool depends(const iir::Stage& fromStage, const iir::Stage& toStage) {
   if(!fromStage.overlaps(toStage))
     return false;
 
+  const auto& toFields = toStage.getFields();
   for(const auto& fromFieldPair : fromStage.getFields()) {
     const iir::Field& fromField = fromFieldPair.second;
-    for(const auto& toFieldPair : toStage.getFields()) {
-      const iir::Field& toField = toFieldPair.second;
-      if(fromField.getAccessID() != toField.getAccessID())
-        continue;
-
-      iir::Field::IntendKind fromFieldIntend = fromField.getIntend();
-      iir::Field::IntendKind toFieldIntend = toField.getIntend();
-
-      switch(fromFieldIntend) {
-      case iir::Field::IntendKind::Output:
-        // This used to check if IntendKind was Input or InputOutput, but this
-        // reorders stages when there is a WAW dependency. Instead, we should
-        // catch all output dependencies
+    auto toFieldIt = toFields.find(fromField.getAccessID());
+    if(toFieldIt == toFields.end())
+      continue;
+
+    iir::Field::IntendKind fromFieldIntend = fromField.getIntend();
+    iir::Field::IntendKind toFieldIntend = toFieldIt->second.getIntend();
+
+    switch(fromFieldIntend) {
+    case iir::Field::IntendKind::Output:
+      // This used to check if IntendKind was Input or InputOutput, but this
+      // reorders stages when there is a WAW dependency. Instead, we should
+      // catch all output dependencies
+      return true;
+      break;
+    case iir::Field::IntendKind::InputOutput:
+      return true;
+    case iir::Field::IntendKind::Input:
+      if(toFieldIntend == iir::Field::IntendKind::Output ||
+         toFieldIntend == iir::Field::IntendKind::InputOutput)
         return true;
-        break;
-      case iir::Field::IntendKind::InputOutput:
-        return true;
-      case iir::Field::IntendKind::Input:
-        if(toFieldIntend == iir::Field::IntendKind::Output ||
-           toFieldIntend == iir::Field::IntendKind::InputOutput)
-          return true;
-        break;
-      }
+      break;
     }
   }
   return false;
@@ -65,18 +65,23 @@ bool PassSetStageGraph::run(
 
   for(const auto& stencilPtr : stencilInstantiation->getStencils()) {
     iir::Stencil& stencil = *stencilPtr;
-    int numStages = stencil.getNumStages();
+
+    // Stencil::getStage(int) is linear in the number of stages, collect them once
+    std::vector<const iir::Stage*> stages;
+    for(const auto& stage : iterateIIROver<iir::Stage>(stencil))
+      stages.push_back(stage.get());
+    int numStages = stages.size();
 
     auto stageDAG = iir::DependencyGraphStage(stencilInstantiation);
 
     // Build DAG of stages (backward sweep)
     for(int i = numStages - 1; i >= 0; --i) {
-      const auto& fromStagePtr = stencil.getStage(i);
+      const iir::Stage* fromStagePtr = stages[i];
       stageDAG.insertNode(fromStagePtr->getStageID());
       int curStageID = fromStagePtr->getStageID();
 
       for(int j = i - 1; j >= 0; --j) {
-        const auto& toStagePtr = stencil.getStage(j);
+        const iir::Stage* toStagePtr = stages[j];
         if(depends(*fromStagePtr, *toStagePtr))
           stageDAG.insertEdge(curStageID, toStagePtr->getStageID());
       }
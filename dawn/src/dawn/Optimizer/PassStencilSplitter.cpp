@@ -16,19 +16,65 @@
 #include "dawn/IIR/DependencyGraphStage.h"
 #include "dawn/IIR/StencilInstantiation.h"
 #include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassSetBlockSize.h"
 #include "dawn/Optimizer/PassSetStageGraph.h"
 #include "dawn/Optimizer/PassTemporaryType.h"
 #include "dawn/Optimizer/Replacing.h"
-#include <iostream>
+#include "dawn/Support/Array.h"
+#include <set>
+#include <unordered_map>
 
 namespace dawn {
 
+namespace {
+
+/// Extents of the fields accessed by the stages of a multi-stage, indexed by AccessID
+using FieldExtentsMap = std::unordered_map<int, iir::Extents>;
+
+/// @brief Estimate the working set of a multi-stage computed block by block, i.e the bytes of all
+/// its fields (extended by their extents, including redundant computations) a block keeps in the
+/// cache, as estimated by the cost model of `PassSetBlockSize`
+std::size_t computeWorkingSet(const FieldExtentsMap& fields, const Array3ui& blockSize,
+                              const HardwareConfig& config) {
+  std::size_t workingSet = 0;
+  for(const auto& fieldPair : fields)
+    workingSet += PassSetBlockSize::getFieldWorkingSet(blockSize, fieldPair.second, config);
+  return workingSet;
+}
+
+/// @brief Merge the fields accessed by `stage` into `fields`
+void mergeFields(FieldExtentsMap& fields, const iir::Stage& stage) {
+  for(const auto& fieldPair : stage.getFields()) {
+    auto it = fields.find(fieldPair.first);
+    if(it == fields.end())
+      fields.emplace(fieldPair.first, fieldPair.second.getExtentsRB());
+    else
+      it->second.merge(fieldPair.second.getExtentsRB());
+  }
+}
+
+/// @brief Check if the working set of any multi-stage of `stencil` exceeds the L2 cache
+bool exceedsCacheCapacity(const iir::Stencil& stencil, const Array3ui& blockSize,
+                          const HardwareConfig& config) {
+  for(const auto& multiStage : stencil.getChildren()) {
+    FieldExtentsMap fields;
+    for(const auto& fieldPair : multiStage->getFields())
+      fields.emplace(fieldPair.first, fieldPair.second.getExtentsRB());
+    if(computeWorkingSet(fields, blockSize, config) > config.L2CacheSize)
+      return true;
+  }
+  return false;
+}
+
 /// @brief Check if we can merge `stage` into the stencil (given by `fields`) such that the number
-/// of fields does not exceed `maxNumFields`
+/// of fields does not exceed `maxNumFields` and the working set of the current multi-stage (given
+/// by `multiStageFields`) still fits into the L2 cache
 ///
 /// If the number of fields is already higher than `maxNumFields` we check if by merging stage into
 /// the stencil we do not increase the number of fields further.
-static int mergePossible(const std::set<int>& fields, const iir::Stage* stage, int maxNumFields) {
+bool mergePossible(const std::set<int>& fields, const FieldExtentsMap& multiStageFields,
+                   const iir::Stage* stage, int maxNumFields, const Array3ui& blockSize,
+                   const HardwareConfig& config) {
   int numFields = fields.size();
 
   for(const auto& fieldPair : stage->getFields())
@@ -36,12 +82,20 @@ static int mergePossible(const std::set<int>& fields, const iir::Stage* stage, i
       numFields++;
 
   // Inserting the stage would further increase the number of fields
-  if(fields.size() > maxNumFields)
-    return numFields == fields.size();
+  if(fields.size() > maxNumFields ? numFields != fields.size() : numFields > maxNumFields)
+    return false;
+
+  // A multi-stage which has no stages yet can not get any smaller
+  if(multiStageFields.empty())
+    return true;
 
-  return numFields <= maxNumFields;
+  FieldExtentsMap mergedFields = multiStageFields;
+  mergeFields(mergedFields, *stage);
+  return computeWorkingSet(mergedFields, blockSize, config) <= config.L2CacheSize;
 }
 
+} // anonymous namespace
+
 PassStencilSplitter::PassStencilSplitter(OptimizerContext& context, int maxNumberOfFilelds)
     : Pass(context, "PassStencilSplitter"), MaxFieldPerStencil(maxNumberOfFilelds) {
   dependencies_.push_back("PassSetStageGraph");
@@ -55,6 +109,12 @@ bool PassStencilSplitter::run(
   // If we split a stencil, we need to recompute the stage graphs
   bool rerunPassSetStageGraph = false;
 
+  const HardwareConfig& config = context_.getHardwareConfiguration();
+  // The block size is only set after the splitting, estimate the working sets with the one
+  // PassSetBlockSize would choose now
+  const Array3ui blockSize =
+      PassSetBlockSize::computeBlockSize(*stencilInstantiation->getIIR(), context_);
+
   for(auto stencilIt = stencilInstantiation->getIIR()->childrenBegin();
       stencilIt != stencilInstantiation->getIIR()->childrenEnd(); ++stencilIt) {
 
@@ -63,16 +123,18 @@ bool PassStencilSplitter::run(
     // New stencils which serve as a replacement for `stencil`
     std::vector<std::unique_ptr<iir::Stencil>> newStencils;
 
-    // If a stencil exceeds the threshold, we need to split it
-    if(stencil.getFields().size() > MaxFieldPerStencil) {
+    // If a stencil exceeds the threshold or one of its multi-stages thrashes the cache, we need to
+    // split it
+    if(stencil.getFields().size() > MaxFieldPerStencil ||
+       exceedsCacheCapacity(stencil, blockSize, config)) {
       rerunPassSetStageGraph = true;
 
       newStencils.emplace_back(std::make_unique<iir::Stencil>(stencilInstantiation->getMetaData(),
                                                               stencil.getStencilAttributes(),
                                                               stencilInstantiation->nextUID()));
-      const std::unique_ptr<iir::Stencil>& newStencil = newStencils.back();
 
       std::set<int> fieldsInNewStencil;
+      FieldExtentsMap fieldsInNewMultiStage;
 
       // Iterate the multi-stage of the old `stencil` and insert its stages into `newStencil`
       for(const auto& multiStagePtr : stencil.getChildren()) {
@@ -80,12 +142,22 @@ bool PassStencilSplitter::run(
 
         // Create an empty multi-stage in the current stencil with the same parameter as
         // `multiStage`
-        newStencil->insertChild(std::make_unique<iir::MultiStage>(
+        newStencils.back()->insertChild(std::make_unique<iir::MultiStage>(
             stencilInstantiation->getMetaData(), multiStage.getLoopOrder()));
+        fieldsInNewMultiStage.clear();
 
         for(const auto& stagePtr : multiStage.getChildren()) {
-          if(newStencil->isEmpty() ||
-             mergePossible(fieldsInNewStencil, stagePtr.get(), MaxFieldPerStencil)) {
+          const std::unique_ptr<iir::Stencil>& newStencil = newStencils.back();
+
+          // Splitting a vertical sweep into two sweeps breaks its loop-carried dependencies, hence
+          // only parallel multi-stages can be split in between stages
+          const bool splitPossible =
+              multiStage.getLoopOrder() == iir::LoopOrderKind::Parallel ||
+              stagePtr == multiStage.getChildren().front();
+
+          if(newStencil->isEmpty() || !splitPossible ||
+             mergePossible(fieldsInNewStencil, fieldsInNewMultiStage, stagePtr.get(),
+                           MaxFieldPerStencil, blockSize, config)) {
 
             // We can safely insert the stage into the current multi-stage of the `newStencil`
             newStencil->getChildren().back()->insertChild(stagePtr->clone());
@@ -94,6 +166,7 @@ bool PassStencilSplitter::run(
             // update their fields as they remain the same.
             for(const auto& fieldPair : stagePtr->getFields())
               fieldsInNewStencil.insert(fieldPair.second.getAccessID());
+            mergeFields(fieldsInNewMultiStage, *stagePtr);
 
           } else {
             // Make a new stencil
@@ -103,6 +176,10 @@ bool PassStencilSplitter::run(
             const std::unique_ptr<iir::Stencil>& newStencil2 = newStencils.back();
 
             fieldsInNewStencil.clear();
+            for(const auto& fieldPair : stagePtr->getFields())
+              fieldsInNewStencil.insert(fieldPair.second.getAccessID());
+            fieldsInNewMultiStage.clear();
+            mergeFields(fieldsInNewMultiStage, *stagePtr);
 
             // Re-create the current multi-stage in the `newStencil` and insert the stage
             newStencil2->insertChild(std::make_unique<iir::MultiStage>(
@@ -21,6 +21,13 @@ namespace dawn {
 
 /// @brief Pass for splitting stencils due to software limitations i.e stencils are too large
 ///
+/// A stencil is split if it accesses more than `MaxFieldPerStencil` fields or if the estimated
+/// working set of one of its multi-stages, i.e the bytes of all fields a block of the IIR's block
+/// size touches including the extents of the fields, exceeds `HardwareConfig::L2CacheSize`. The
+/// stages are then greedily distributed, in order, over new stencils which stay within both limits.
+/// Only parallel multi-stages are split in between stages. The pass is only run if
+/// `-split-stencils` is passed.
+///
 /// This Pass depends on `PassSetStageGraph`.
 ///
 /// @ingroup optimizer
@@ -28,6 +28,8 @@
 #include "dawn/SIR/AST.h"
 #include "dawn/SIR/SIR.h"
 #include "dawn/Support/RemoveIf.hpp"
+#include <algorithm>
+#include <stack>
 
 namespace dawn {
 
@@ -508,6 +510,121 @@ public:
   }
 };
 
+/// @brief Cost of computing a temporary on the fly instead of storing it in a field
+struct RecomputeCost {
+  int numOps = 0;                        ///< arithmetic operations of the defining expression
+  std::vector<ast::Offsets> readOffsets; ///< distinct offsets at which the temporary is read
+
+  /// @brief Bytes per grid point saved by not materializing the temporary, i.e the store and the
+  /// reload of the field from main memory
+  int getBytesSaved(const HardwareConfig& config) const { return 2 * config.FloatSize; }
+
+  /// @brief Inlining evaluates the definition once per distinct read offset instead of once per
+  /// grid point, which only pays off if the additional operations take less time than the memory
+  /// round trip of the temporary
+  bool isRecomputationCheaper(const HardwareConfig& config) const {
+    const int numEvaluations = std::max(static_cast<int>(readOffsets.size()), 1);
+    const double extraOps = numOps * (numEvaluations - 1);
+    return extraOps / config.FlopRate < getBytesSaved(config) / config.DRAMBandwidth;
+  }
+};
+
+/// @brief Counts the arithmetic operations of an expression, including the ones of the stencil
+/// functions it calls
+class OpCounter : public iir::ASTVisitorForwarding {
+  const iir::StencilMetaInformation& metadata_;
+  std::stack<std::shared_ptr<iir::StencilFunctionInstantiation>> stencilFunCalls_;
+  int numOps_ = 0;
+
+public:
+  /// Operations accounted for a call to a math function (e.g `sqrt` or `exp`)
+  static constexpr int MathFunctionOps = 10;
+
+  OpCounter(const iir::StencilMetaInformation& metadata) : metadata_(metadata) {}
+
+  int getNumOps() const { return numOps_; }
+
+  void visit(const std::shared_ptr<iir::UnaryOperator>& expr) override {
+    numOps_++;
+    iir::ASTVisitorForwarding::visit(expr);
+  }
+  void visit(const std::shared_ptr<iir::BinaryOperator>& expr) override {
+    numOps_++;
+    iir::ASTVisitorForwarding::visit(expr);
+  }
+  void visit(const std::shared_ptr<iir::TernaryOperator>& expr) override {
+    numOps_++;
+    iir::ASTVisitorForwarding::visit(expr);
+  }
+  void visit(const std::shared_ptr<iir::FunCallExpr>& expr) override {
+    numOps_ += MathFunctionOps;
+    iir::ASTVisitorForwarding::visit(expr);
+  }
+  void visit(const std::shared_ptr<iir::StencilFunCallExpr>& expr) override {
+    auto stencilFun = stencilFunCalls_.empty()
+                          ? metadata_.getStencilFunctionInstantiation(expr)
+                          : stencilFunCalls_.top()->getStencilFunctionInstantiation(expr);
+    stencilFunCalls_.push(stencilFun);
+    stencilFun->getAST()->accept(*this);
+    stencilFunCalls_.pop();
+    iir::ASTVisitorForwarding::visit(expr);
+  }
+};
+
+/// @brief Collects the cost of recomputing each temporary written in a multi-stage
+///
+/// A field passed to a stencil function is read at the offsets of the accesses in the function,
+/// shifted by the offset of the argument, hence the collector walks into the called functions.
+class RecomputeCostCollector : public iir::ASTVisitorForwarding {
+  const iir::StencilMetaInformation& metadata_;
+  std::stack<std::shared_ptr<iir::StencilFunctionInstantiation>> stencilFunCalls_;
+  std::unordered_map<int, RecomputeCost> costs_;
+
+public:
+  RecomputeCostCollector(const iir::StencilMetaInformation& metadata) : metadata_(metadata) {}
+
+  RecomputeCost getCost(int accessID) const {
+    auto it = costs_.find(accessID);
+    return it != costs_.end() ? it->second : RecomputeCost();
+  }
+
+  void visit(const std::shared_ptr<iir::AssignmentExpr>& expr) override {
+    if(isa<iir::FieldAccessExpr>(*expr->getLeft())) {
+      // the most expensive definition determines the cost of the temporary
+      OpCounter opCounter(metadata_);
+      expr->getRight()->accept(opCounter);
+      int& numOps = costs_[iir::getAccessID(expr->getLeft())].numOps;
+      numOps = std::max(numOps, opCounter.getNumOps());
+      expr->getRight()->accept(*this);
+    } else {
+      iir::ASTVisitorForwarding::visit(expr);
+    }
+  }
+
+  void visit(const std::shared_ptr<iir::StencilFunCallExpr>& expr) override {
+    // field arguments are accounted for by their accesses in the function
+    for(const auto& arg : expr->getArguments())
+      if(!isa<iir::FieldAccessExpr>(*arg))
+        arg->accept(*this);
+
+    auto stencilFun = stencilFunCalls_.empty()
+                          ? metadata_.getStencilFunctionInstantiation(expr)
+                          : stencilFunCalls_.top()->getStencilFunctionInstantiation(expr);
+    stencilFunCalls_.push(stencilFun);
+    stencilFun->getAST()->accept(*this);
+    stencilFunCalls_.pop();
+  }
+
+  void visit(const std::shared_ptr<iir::FieldAccessExpr>& expr) override {
+    const ast::Offsets offset =
+        stencilFunCalls_.empty() ? expr->getOffset()
+                                 : stencilFunCalls_.top()->evalOffsetOfFieldAccessExpr(expr, true);
+    auto& readOffsets = costs_[iir::getAccessID(expr)].readOffsets;
+    if(std::find(readOffsets.begin(), readOffsets.end(), offset) == readOffsets.end())
+      readOffsets.push_back(offset);
+  }
+};
+
 } // anonymous namespace
 
 PassTemporaryToStencilFunction::PassTemporaryToStencilFunction(OptimizerContext& context)
@@ -515,9 +632,11 @@ PassTemporaryToStencilFunction::PassTemporaryToStencilFunction(OptimizerContext&
 
 SkipIDs PassTemporaryToStencilFunction::computeSkipAccessIDs(
     const std::unique_ptr<iir::Stencil>& stencilPtr,
-    const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) const {
+    const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation,
+    bool reportCosts) const {
 
   const auto& metadata = stencilInstantiation->getMetaData();
+  const HardwareConfig& config = context_.getHardwareConfiguration();
   SkipIDs skipIDs;
   // Iterate multi-stages backwards in order to identify local variables that need to be promoted
   // to temporaries
@@ -533,6 +652,11 @@ SkipIDs PassTemporaryToStencilFunction::computeSkipAccessIDs(
 
     // all the fields with self-dependencies are discarded, e.g. w += w[k+1]
     skipIDs.insertAccessIDsOfMS(multiStage->getID(), graph.computeIDsWithCycles());
+
+    RecomputeCostCollector costCollector(metadata);
+    for(const auto& stmt : iterateIIROverStmt(*multiStage))
+      stmt->accept(costCollector);
+
     for(const auto& fieldPair : multiStage->getFields()) {
       const auto& field = fieldPair.second;
 
@@ -559,6 +683,20 @@ SkipIDs PassTemporaryToStencilFunction::computeSkipAccessIDs(
         skipIDs.appendAccessIDsToMS(multiStage->getID(), field.getAccessID());
         continue;
       }
+      // we only compute the temporary on the fly if that is cheaper than storing it
+      const RecomputeCost cost = costCollector.getCost(field.getAccessID());
+      const bool recompute = cost.isRecomputationCheaper(config);
+      if(reportCosts) {
+        std::cout << "\nPASS: " << getName() << "; stencil: " << stencilInstantiation->getName()
+                  << "; tmp: " << metadata.getFieldNameFromAccessID(field.getAccessID())
+                  << "; ops: " << cost.numOps << "; read offsets: " << cost.readOffsets.size()
+                  << "; bytes saved: " << cost.getBytesSaved(config) << "; "
+                  << (recompute ? "recompute" : "store") << "\n";
+      }
+      if(!recompute) {
+        skipIDs.appendAccessIDsToMS(multiStage->getID(), field.getAccessID());
+        continue;
+      }
     }
   }
 
@@ -606,7 +744,8 @@ bool PassTemporaryToStencilFunction::run(
                                            iir::TemporaryScope::StencilTemporary);
     }
 
-    skipIDs = computeSkipAccessIDs(stencilPtr, stencilInstantiation);
+    skipIDs = computeSkipAccessIDs(stencilPtr, stencilInstantiation,
+                                   context_.getOptions().ReportPassTmpToFunction);
 
     // Iterate multi-stages for the replacement of temporaries by stencil functions
     for(const auto& multiStage : stencilPtr->getChildren()) {
@@ -57,9 +57,12 @@ public:
   bool run(const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) override;
 
 private:
+  /// @brief Compute the temporaries of each multi-stage which are not replaced, either because
+  /// they do not qualify or because recomputing them is more expensive than storing them
   SkipIDs computeSkipAccessIDs(
       const std::unique_ptr<iir::Stencil>& stencilPtr,
-      const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation) const;
+      const std::shared_ptr<iir::StencilInstantiation>& stencilInstantiation,
+      bool reportCosts = false) const;
 };
 
 } // namespace dawn
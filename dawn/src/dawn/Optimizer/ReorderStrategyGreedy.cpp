@@ -27,12 +27,10 @@
 
 namespace dawn {
 
-/// @brief Check if we can merge the stage into the multi-stage, possibly changing the loop order.
-/// @returns the the enew dependency graphs of the multi-stage (or NULL) and the new loop order
-template <typename ReturnType =
-              std::pair<std::optional<iir::DependencyGraphAccesses>, iir::LoopOrderKind>>
-ReturnType isMergable(const iir::Stage& stage, iir::LoopOrderKind stageLoopOrder,
-                      const iir::MultiStage& multiStage) {
+std::pair<std::optional<iir::DependencyGraphAccesses>, iir::LoopOrderKind>
+isMergable(const iir::Stage& stage, iir::LoopOrderKind stageLoopOrder,
+           const iir::MultiStage& multiStage) {
+  using ReturnType = std::pair<std::optional<iir::DependencyGraphAccesses>, iir::LoopOrderKind>;
   iir::LoopOrderKind multiStageLoopOrder = multiStage.getLoopOrder();
   auto multiStageDependencyGraph =
       multiStage.getDependencyGraphOfInterval(stage.getEnclosingExtendedInterval());
@@ -67,7 +65,7 @@ ReturnType isMergable(const iir::Stage& stage, iir::LoopOrderKind stageLoopOrder
     possibleLoopOrders.push_back(stageLoopOrder);
 
   if(multiStageDependencyGraph.empty())
-    return ReturnType(multiStageDependencyGraph, possibleLoopOrders.front());
+    return ReturnType(std::move(multiStageDependencyGraph), possibleLoopOrders.front());
 
   // If the resulting graph isn't a DAG anymore that isn't gonna work
   if(!multiStageDependencyGraph.isDAG())
@@ -77,7 +75,7 @@ ReturnType isMergable(const iir::Stage& stage, iir::LoopOrderKind stageLoopOrder
   for(auto loopOrder : possibleLoopOrders) {
     auto conflict = hasVerticalReadBeforeWriteConflict(multiStageDependencyGraph, loopOrder);
     if(!conflict.CounterLoopOrderConflict)
-      return ReturnType(multiStageDependencyGraph, loopOrder);
+      return ReturnType(std::move(multiStageDependencyGraph), loopOrder);
   }
 
   return ReturnType(std::nullopt, multiStageLoopOrder);
@@ -135,7 +133,7 @@ ReoderStrategyGreedy::reorder(iir::StencilInstantiation* instantiation,
 
           // 2) Can we merge the stage without violating vertical dependencies?
           auto dependencyGraphLoopOrderPair = isMergable(stage, stageLoopOrder, *MS);
-          auto multiStageDependencyGraph = dependencyGraphLoopOrderPair.first;
+          const auto& multiStageDependencyGraph = dependencyGraphLoopOrderPair.first;
 
           if(multiStageDependencyGraph) {
 
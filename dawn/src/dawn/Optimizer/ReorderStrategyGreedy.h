@@ -15,13 +15,27 @@
 #ifndef DAWN_OPTIMIZER_REORDERSTRATEGYGREEDY_H
 #define DAWN_OPTIMIZER_REORDERSTRATEGYGREEDY_H
 
+#include "dawn/IIR/DependencyGraphAccesses.h"
+#include "dawn/IIR/LoopOrder.h"
 #include "dawn/Optimizer/ReorderStrategy.h"
+#include <optional>
+#include <utility>
 
 namespace dawn {
 
 namespace iir {
+class MultiStage;
+class Stage;
 class StencilInstantiation;
-}
+} // namespace iir
+
+/// @brief Check if we can merge the stage into the multi-stage, possibly changing the loop order.
+/// @returns the the enew dependency graphs of the multi-stage (or NULL) and the new loop order
+/// @ingroup optimizer
+std::pair<std::optional<iir::DependencyGraphAccesses>, iir::LoopOrderKind>
+isMergable(const iir::Stage& stage, iir::LoopOrderKind stageLoopOrder,
+           const iir::MultiStage& multiStage);
+
 /// @brief Reordering strategy which tries to move each stage upwards as far as possible under the
 /// sole constraint that the extent of any field does not exeed the maximum halo points
 /// @ingroup optimizer
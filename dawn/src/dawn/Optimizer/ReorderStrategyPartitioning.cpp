@@ -14,17 +14,125 @@
 
 #include "dawn/Optimizer/ReorderStrategyPartitioning.h"
 #include "dawn/IIR/DependencyGraphAccesses.h"
+#include "dawn/IIR/DependencyGraphStage.h"
+#include "dawn/IIR/MultiStage.h"
+#include "dawn/IIR/Stencil.h"
 #include "dawn/IIR/StencilInstantiation.h"
 #include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/ReorderStrategyGreedy.h"
+#include <limits>
+#include <vector>
 
 namespace dawn {
 
+namespace {
+
+struct StageNode {
+  std::unique_ptr<iir::Stage>* Stage;
+  iir::LoopOrderKind LoopOrder;
+  std::vector<int> Predecessors; ///< Indices of the stages this stage depends on
+  bool Placed = false;
+};
+
+} // anonymous namespace
+
 std::unique_ptr<iir::Stencil>
 ReoderStrategyPartitioning::reorder(iir::StencilInstantiation* instantiation,
                                     const std::unique_ptr<iir::Stencil>& stencilPtr,
                                     OptimizerContext& context) {
-  DAWN_ASSERT("ReoderStrategyPartitioning is not yet implemented");
-  return nullptr;
+  iir::Stencil& stencil = *stencilPtr;
+
+  auto const& stageDAG = *stencil.getStageDependencyGraph();
+
+  auto& metadata = instantiation->getMetaData();
+  std::unique_ptr<iir::Stencil> newStencil = std::make_unique<iir::Stencil>(
+      metadata, stencil.getStencilAttributes(), stencilPtr->getStencilID());
+
+  newStencil->setStageDependencyGraph(iir::DependencyGraphStage(stageDAG));
+
+  const int maxBoundaryExtent = context.getOptions().MaxHaloPoints;
+
+  // Flatten the stages (in their original order) and record their predecessors in the stage graph.
+  // The stage graph contains an edge for every pair of dependent stages, hence a stage whose
+  // predecessors have all been placed can go into any multi-stage from the current one onwards.
+  std::vector<StageNode> nodes;
+  for(const auto& multiStagePtr : stencil.getChildren())
+    for(auto& stagePtr : multiStagePtr->getChildren())
+      nodes.push_back(StageNode{&stagePtr, multiStagePtr->getLoopOrder(), {}});
+
+  for(int i = 0; i < nodes.size(); ++i)
+    for(int j = 0; j < i; ++j)
+      if(stageDAG.depends((*nodes[i].Stage)->getStageID(), (*nodes[j].Stage)->getStageID()))
+        nodes[i].Predecessors.push_back(j);
+
+  auto isReady = [&](const StageNode& node) {
+    for(int predecessor : node.Predecessors)
+      if(!nodes[predecessor].Placed)
+        return false;
+    return true;
+  };
+
+  // Partition the stage graph into multi-stages (S-cuts) by list scheduling: each multi-stage is
+  // grown by the ready stage which can be merged without vertical read-before-write conflicts,
+  // within the maximum number of halo points, and which yields the smallest halo-exchange volume.
+  // A cut is made once no ready stage can be merged anymore.
+  int numPlacedStages = 0;
+  while(numPlacedStages != nodes.size()) {
+    newStencil->insertChild(
+        std::make_unique<iir::MultiStage>(metadata, iir::LoopOrderKind::Parallel));
+    const auto& MS = newStencil->getChildren().back();
+
+    while(true) {
+      int bestIdx = -1;
+      int bestNumBoundaryPoints = std::numeric_limits<int>::max();
+      iir::LoopOrderKind bestLoopOrder = MS->getLoopOrder();
+      int firstReadyIdx = -1;
+
+      for(int i = 0; i < nodes.size(); ++i) {
+        const StageNode& node = nodes[i];
+        if(node.Placed || !isReady(node))
+          continue;
+        if(firstReadyIdx == -1)
+          firstReadyIdx = i;
+
+        if(!loopOrdersAreCompatible(node.LoopOrder, MS->getLoopOrder()))
+          continue;
+
+        auto dependencyGraphLoopOrderPair = isMergable(**node.Stage, node.LoopOrder, *MS);
+        auto& multiStageDependencyGraph = dependencyGraphLoopOrderPair.first;
+        if(!multiStageDependencyGraph ||
+           multiStageDependencyGraph->exceedsMaxBoundaryPoints(maxBoundaryExtent))
+          continue;
+
+        int numBoundaryPoints = multiStageDependencyGraph->getNumBoundaryPoints();
+        if(numBoundaryPoints < bestNumBoundaryPoints) {
+          bestIdx = i;
+          bestNumBoundaryPoints = numBoundaryPoints;
+          bestLoopOrder = dependencyGraphLoopOrderPair.second;
+        }
+      }
+
+      if(bestIdx == -1) {
+        if(!MS->childrenEmpty())
+          break;
+
+        // Not even an empty multi-stage can hold the next stage ... nothing we can do
+        DAWN_ASSERT_MSG(firstReadyIdx != -1, "stage graph contains cycles - i.e is not a DAG!");
+        DiagnosticsBuilder diag(DiagnosticsKind::Error, SourceLocation());
+        diag << "stencil '" << instantiation->getName()
+             << "' exceeds maximum number of allowed halo lines (" << maxBoundaryExtent << ")";
+        context.getDiagnostics().report(diag);
+        return nullptr;
+      }
+
+      MS->setLoopOrder(bestLoopOrder);
+      MS->insertChild(std::move(*nodes[bestIdx].Stage));
+      nodes[bestIdx].Placed = true;
+      numPlacedStages++;
+    }
+  }
+
+  return newStencil;
 }
 
 } // namespace dawn
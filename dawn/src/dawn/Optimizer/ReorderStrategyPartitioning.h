@@ -21,6 +21,11 @@ namespace dawn {
 
 /// @brief Reordering strategy which uses S-cut graph partitioning to reorder the stages and
 /// statements
+///
+/// The stage dependency graph is cut into as few multi-stages as possible. Each multi-stage is
+/// filled with the stages whose dependencies are already scheduled, preferring the stage which
+/// adds the least halo points, as long as neither the maximum number of halo points is exceeded
+/// nor a vertical read-before-write conflict is introduced.
 /// @ingroup optimizer
 class ReoderStrategyPartitioning : public ReorderStrategy {
 public:
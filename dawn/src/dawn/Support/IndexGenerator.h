@@ -16,6 +16,7 @@
 #define DAWN_SUPPORT_INDEXGENERATOR_H
 
 #include "dawn/Support/Assert.h"
+#include <atomic>
 #include <limits>
 #include <memory>
 
@@ -28,7 +29,7 @@ private:
 
   static std::unique_ptr<IndexGenerator> instance;
 
-  long unsigned int idx_ = 0;
+  std::atomic<long unsigned int> idx_{0};
 
 private:
   IndexGenerator() = default;
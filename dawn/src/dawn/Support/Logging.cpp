@@ -31,7 +31,7 @@ internal::LoggerProxy::~LoggerProxy() {
   ss_.get().clear();
 }
 
-Logger* Logger::instance_ = nullptr;
+thread_local std::stringstream Logger::ss_;
 
 Logger::Logger() : isDefault_(true) { registerLogger(new DawnLogger); }
 Logger::~Logger() {
@@ -63,16 +63,16 @@ internal::LoggerProxy Logger::logInfo(const char* file, int line) {
 }
 
 void Logger::log(LoggingLevel level, const std::string& message, const char* file, int line) {
+  std::lock_guard<std::mutex> lock(mutex_);
   if(logger_ != nullptr) {
     logger_->log(level, message, file, line);
   }
 }
 
 Logger& Logger::getSingleton() {
-  if(instance_ == nullptr) {
-    instance_ = new Logger;
-  }
-  return *instance_;
+  // initialization of function-local statics is thread-safe
+  static Logger* instance = new Logger;
+  return *instance;
 }
 
 DawnLogger::DawnLogger(LoggingLevel level) : level_(level) {}
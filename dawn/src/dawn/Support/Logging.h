@@ -16,6 +16,7 @@
 #define DAWN_SUPPORT_LOGGING_H
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -70,11 +71,14 @@ public:
 /// but if you would like to register your own, you need to implement the `LoggerInterface` and call
 /// `registerLogger` on an instance.
 ///
+/// Messages are assembled in a per-thread stream and handed to the registered logger one at a time,
+/// hence logging from several threads is safe.
+///
 /// @ingroup support
 class Logger {
-  static Logger* instance_;
   LoggerInterface* logger_;
-  std::stringstream ss_;
+  static thread_local std::stringstream ss_;
+  std::mutex mutex_;
   bool isDefault_;
 
 public:
@@ -13,18 +13,46 @@
 //===------------------------------------------------------------------------------------------===//
 
 #include "dawn/Support/UIDGenerator.h"
+#include "dawn/Support/Logging.h"
+#include <limits>
+#include <stdexcept>
 
 namespace dawn {
 
-/* Null, because instance will be initialized on demand. */
-UIDGenerator* UIDGenerator::instance_ = 0;
+thread_local UIDGenerator::ScopedBlock* UIDGenerator::block_ = nullptr;
 
 UIDGenerator* UIDGenerator::getInstance() {
-  if(instance_ == 0) {
-    instance_ = new UIDGenerator();
-  }
+  // initialization of function-local statics is thread-safe
+  static UIDGenerator instance;
+  return &instance;
+}
+
+int UIDGenerator::reserve(std::size_t size) {
+  int first = counter_.load();
+  do {
+    if(size > std::size_t(std::numeric_limits<int>::max() - first))
+      throw std::runtime_error("unique identifiers exhausted");
+  } while(!counter_.compare_exchange_weak(first, first + int(size)));
+  return first;
+}
+
+bool UIDGenerator::rewind(int first, int end) {
+  return counter_.compare_exchange_strong(end, first);
+}
+
+UIDGenerator::ScopedBlock::ScopedBlock(int first, int size)
+    : next_(first), end_(first + size), size_(size), previous_(block_) {
+  block_ = this;
+}
+
+UIDGenerator::ScopedBlock::~ScopedBlock() { block_ = previous_; }
 
-  return instance_;
+void UIDGenerator::ScopedBlock::refill() {
+  DAWN_LOG(WARNING) << "block of " << size_
+                    << " unique identifiers exhausted, the identifiers may depend on the thread "
+                       "schedule";
+  next_ = getInstance()->reserve(size_);
+  end_ = next_ + size_;
 }
 
 } // namespace dawn
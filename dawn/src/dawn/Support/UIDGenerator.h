@@ -16,14 +16,25 @@
 #define DAWN_SUPPORT_UIDGENERATOR
 
 #include "dawn/Support/NonCopyable.h"
+#include <atomic>
+#include <cstddef>
 
 namespace dawn {
 
 /// @brief Unique identifier generator (starting from @b 1)
+///
+/// The generator is thread-safe. Threads which need reproducible identifiers independent of the
+/// scheduling of other threads can draw them from a block reserved upfront (see `ScopedBlock`).
 /// @ingroup support
 class UIDGenerator : NonCopyable {
-  int counter_;
-  static UIDGenerator* instance_;
+public:
+  class ScopedBlock;
+
+private:
+  std::atomic<int> counter_;
+
+  /// Block the current thread draws its identifiers from (`nullptr` if none)
+  static thread_local ScopedBlock* block_;
 
   UIDGenerator() : counter_(1) {}
 
@@ -31,14 +42,53 @@ public:
   static UIDGenerator* getInstance();
 
   /// @brief Get a unique *strictly* positive identifer
-  int get() { return (counter_++); }
+  int get();
 
   void reset() { set(1); }
 
   /// @brief We need a way to modify the generator after deserialization
   void set(int id) { counter_ = id; }
+
+  /// @brief Reserve `size` consecutive identifiers and return the first one
+  /// @throws std::runtime_error if less than `size` identifiers are left
+  int reserve(std::size_t size);
+
+  /// @brief Give back the identifiers from `first` up to `end` (exclusive), which are the unused
+  /// tail of a reservation, if no identifier has been handed out after them in the meantime
+  /// @returns whether the identifiers were given back
+  bool rewind(int first, int end);
+
+  /// @brief Makes `get` hand out the identifiers of a reserved block of `size` identifiers on the
+  /// current thread while the object is alive
+  ///
+  /// An exhausted block continues with a block of the same size reserved from the generator. Its
+  /// identifiers are unique as well, yet they depend on the order in which the threads exhaust
+  /// their blocks.
+  class ScopedBlock : NonCopyable {
+    int next_;
+    int end_;
+    int size_;
+    ScopedBlock* previous_;
+
+    void refill();
+
+  public:
+    ScopedBlock(int first, int size);
+    ~ScopedBlock();
+
+    int get() {
+      if(next_ == end_)
+        refill();
+      return next_++;
+    }
+
+    /// @brief Identifier the next call to `get` hands out (if the block is not exhausted)
+    int getNext() const { return next_; }
+  };
 };
 
+inline int UIDGenerator::get() { return block_ ? block_->get() : counter_++; }
+
 } // namespace dawn
 
 #endif
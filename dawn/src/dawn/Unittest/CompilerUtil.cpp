@@ -14,8 +14,10 @@
 
 #include "dawn/Unittest/CompilerUtil.h"
 #include "dawn/CodeGen/CXXNaive/CXXNaiveCodeGen.h"
+#include "dawn/CodeGen/CXXOpt/CXXOptCodeGen.h"
 #include "dawn/CodeGen/CodeGen.h"
 #include "dawn/CodeGen/Cuda/CudaCodeGen.h"
+#include "dawn/CodeGen/GridTools/GTCodeGen.h"
 #include "dawn/Optimizer/PassDataLocalityMetric.h"
 #include "dawn/Optimizer/PassFieldVersioning.h"
 #include "dawn/Optimizer/PassFixVersionedInputFields.h"
@@ -43,6 +45,7 @@
 
 #include "dawn/CodeGen/CXXNaive-ico/CXXNaiveCodeGen.h"
 #include "dawn/CodeGen/CXXNaive/CXXNaiveCodeGen.h"
+#include "dawn/CodeGen/CXXOpt/CXXOptCodeGen.h"
 #include "dawn/CodeGen/Cuda/CudaCodeGen.h"
 
 namespace dawn {
@@ -119,19 +122,23 @@ siToContext(std::shared_ptr<iir::StencilInstantiation> si) {
 
 } // namespace
 
-void CompilerUtil::dumpNaive(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si) {
+void CompilerUtil::dumpNaive(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si,
+                             const std::string& loopOrder, bool timers) {
   dawn::DiagnosticsEngine diagnostics;
   auto ctx = siToContext(si);
-  dawn::codegen::cxxnaive::CXXNaiveCodeGen generator(ctx, diagnostics, 0);
+  dawn::codegen::cxxnaive::CXXNaiveCodeGen generator(ctx, diagnostics, 0, loopOrder, timers);
   dump(generator, os);
   if(Verbose)
     dump(generator, std::cerr);
 }
 
-void CompilerUtil::dumpNaiveIco(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si) {
+void CompilerUtil::dumpNaiveIco(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si,
+                                bool staticNbhChains, bool kInnerLoops, bool openMPLoops,
+                                bool timers) {
   dawn::DiagnosticsEngine diagnostics;
   auto ctx = siToContext(si);
-  dawn::codegen::cxxnaiveico::CXXNaiveIcoCodeGen generator(ctx, diagnostics, 0);
+  dawn::codegen::cxxnaiveico::CXXNaiveIcoCodeGen generator(ctx, diagnostics, 0, staticNbhChains,
+                                                           kInnerLoops, openMPLoops, timers);
   dump(generator, os);
   if(Verbose)
     dump(generator, std::cerr);
@@ -146,6 +153,24 @@ void CompilerUtil::dumpCuda(std::ostream& os, std::shared_ptr<iir::StencilInstan
     dump(generator, std::cerr);
 }
 
+void CompilerUtil::dumpCXXOpt(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si) {
+  dawn::DiagnosticsEngine diagnostics;
+  auto ctx = siToContext(si);
+  dawn::codegen::cxxopt::CXXOptCodeGen generator(ctx, diagnostics, 0);
+  dump(generator, os);
+  if(Verbose)
+    dump(generator, std::cerr);
+}
+
+void CompilerUtil::dumpGridTools(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si) {
+  dawn::DiagnosticsEngine diagnostics;
+  auto ctx = siToContext(si);
+  dawn::codegen::gt::GTCodeGen generator(ctx, diagnostics, false, 0);
+  dump(generator, os);
+  if(Verbose)
+    dump(generator, std::cerr);
+}
+
 std::vector<std::shared_ptr<Pass>>
 CompilerUtil::createGroup(PassGroup group, std::unique_ptr<OptimizerContext>& context) {
   auto mssSplitStrategy = dawn::PassMultiStageSplitter::MultiStageSplittingStrategy::Optimized;
@@ -176,6 +201,12 @@ CompilerUtil::createGroup(PassGroup group, std::unique_ptr<OptimizerContext>& co
     addPass<dawn::PassSetStageName>(context, passes);
     break;
 
+  case PassGroup::StencilSplitting:
+    addPass<dawn::PassSetStageGraph>(context, passes);
+    addPass<dawn::PassStencilSplitter>(context, passes, context->getOptions().MaxFieldsPerStencil);
+    addPass<dawn::PassSetSyncStage>(context, passes);
+    break;
+
   case PassGroup::StageMerger:
     addPass<dawn::PassStageMerger>(context, passes);
     // since this can change the scope of temporaries ...
@@ -325,6 +356,13 @@ bool CompilerUtil::runGroup(PassGroup group, std::unique_ptr<OptimizerContext>&
     result &= runPass<dawn::PassSetStageName>(context, instantiation);
     break;
 
+  case PassGroup::StencilSplitting:
+    result &= runPass<dawn::PassSetStageGraph>(context, instantiation);
+    result &= runPass<dawn::PassStencilSplitter>(context, instantiation,
+                                                 context->getOptions().MaxFieldsPerStencil);
+    result &= runPass<dawn::PassSetSyncStage>(context, instantiation);
+    break;
+
   case PassGroup::StageMerger:
     result &= runPass<dawn::PassStageMerger>(context, instantiation);
     result &= runPass<dawn::PassTemporaryType>(context, instantiation);
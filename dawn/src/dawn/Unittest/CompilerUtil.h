@@ -51,9 +51,14 @@ public:
         const dawn::OptimizerContext::OptimizerContextOptions& options,
         std::unique_ptr<OptimizerContext>& context, const std::string& envPath = "");
   static void clearDiags();
-  static void dumpNaive(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si);
-  static void dumpNaiveIco(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si);
+  static void dumpNaive(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si,
+                        const std::string& loopOrder = "kji", bool timers = false);
+  static void dumpNaiveIco(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si,
+                           bool staticNbhChains = false, bool kInnerLoops = false,
+                           bool openMPLoops = false, bool timers = false);
   static void dumpCuda(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si);
+  static void dumpCXXOpt(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si);
+  static void dumpGridTools(std::ostream& os, std::shared_ptr<iir::StencilInstantiation> si);
 
   template <class TPass, typename... Args>
   static void addPass(std::unique_ptr<OptimizerContext>& context,
@@ -297,7 +297,7 @@ public:
     DAWN_ASSERT(si_);
     auto ret = std::make_unique<iir::MultiStage>(si_->getMetaData(), loop_kind);
     ret->setID(si_->nextUID());
-    int x[] = {(ret->insertChild(std::forward<Stages>(stages)), 0)...};
+    int x[] = {0, (ret->insertChild(std::forward<Stages>(stages)), 0)...};
     (void)x;
     return ret;
   }
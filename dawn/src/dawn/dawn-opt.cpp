@@ -49,6 +49,8 @@ dawn::PassGroup parsePassGroup(const std::string& passGroup) {
     return dawn::PassGroup::SetStageName;
   else if(passGroup == "StageReordering" || passGroup == "stage-reordering")
     return dawn::PassGroup::StageReordering;
+  else if(passGroup == "StencilSplitting" || passGroup == "stencil-splitting")
+    return dawn::PassGroup::StencilSplitting;
   else if(passGroup == "StageMerger" || passGroup == "stage-merger")
     return dawn::PassGroup::StageMerger;
   else if(passGroup == "TemporaryMerger" || passGroup == "temporary-merger" ||
@@ -198,7 +200,7 @@ int main(int argc, char* argv[]) {
   // Determine the list of pass groups to run
   std::list<dawn::PassGroup> passGroups;
   if(result.count("default-opt") > 0) {
-    passGroups = dawn::DawnCompiler::defaultPassGroups();
+    passGroups = dawn::DawnCompiler::defaultPassGroups(dawnOptions);
   }
   for(auto pg : result["pass-groups"].as<std::vector<std::string>>()) {
     passGroups.push_back(parsePassGroup(pg));
@@ -19,16 +19,24 @@ PYBIND11_MODULE(_dawn4py, m) {
   py::class_<dawn::Options>(m, "Options")
       .def(py::init(
                [](int MaxBlocksPerSM, int nsms, int DomainSizeI, int DomainSizeJ, int DomainSizeK,
-                  const std::string& Backend, const std::string& OutputFile, bool SerializeIIR,
+                  const std::string& LoopOrder, bool StaticNbhChains, bool KInnerLoops,
+                  bool OpenMPLoops, bool Timers,
+                  const std::string& Backend,
+                  const std::string& OutputFile, bool SerializeIIR,
                   const std::string& DeserializeIIR, const std::string& IIRFormat,
+                  const std::string& CacheDir, int CacheMaxSize,
                   int MaxHaloPoints, const std::string& ReorderStrategy, int MaxFieldsPerStencil,
                   bool MaxCutMSS, int BlockSizeI, int BlockSizeJ, int BlockSizeK,
+                  bool BlockSizeCostModel, const std::string& HardwareConfigFile,
+                  int OptimizerThreads,
                   bool SplitStencils, bool MergeDoMethods, bool UseParallelEP, bool DisableKCaches,
-                  bool UseNonTempCaches, bool KeepVarnames, bool PassVerbose, bool ReportAccesses,
+                  bool UseNonTempCaches, bool KeepVarnames, bool PassVerbose, bool PassTiming,
+                  const std::string& PassTimingTrace, bool ReportAccesses,
                   bool DumpSplitGraphs, bool DumpStageGraph, bool DumpTemporaryGraphs,
                   bool DumpRaceConditionGraph, bool DumpStencilInstantiation, bool DumpStencilGraph,
                   bool SSA, bool PrintStencilGraph, bool SetStageName, bool StageReordering,
-                  bool StageMerger, bool TemporaryMerger, bool Inlining, bool IntervalPartitioning,
+                  bool StencilSplitting, bool StageMerger, bool TemporaryMerger, bool Inlining,
+                  bool IntervalPartitioning,
                   bool TmpToStencilFunction, bool SetNonTempCaches, bool SetCaches,
                   bool SetBlockSize, bool DataLocalityMetric, bool ReportBoundaryConditions,
                   bool ReportDataLocalityMetric, bool ReportPassTmpToFunction,
@@ -43,11 +51,18 @@ PYBIND11_MODULE(_dawn4py, m) {
                                       DomainSizeI,
                                       DomainSizeJ,
                                       DomainSizeK,
+                                      LoopOrder,
+                                      StaticNbhChains,
+                                      KInnerLoops,
+                                      OpenMPLoops,
+                                      Timers,
                                       Backend,
                                       OutputFile,
                                       SerializeIIR,
                                       DeserializeIIR,
                                       IIRFormat,
+                                      CacheDir,
+                                      CacheMaxSize,
                                       MaxHaloPoints,
                                       ReorderStrategy,
                                       MaxFieldsPerStencil,
@@ -55,6 +70,9 @@ PYBIND11_MODULE(_dawn4py, m) {
                                       BlockSizeI,
                                       BlockSizeJ,
                                       BlockSizeK,
+                                      BlockSizeCostModel,
+                                      HardwareConfigFile,
+                                      OptimizerThreads,
                                       SplitStencils,
                                       MergeDoMethods,
                                       UseParallelEP,
@@ -62,6 +80,8 @@ PYBIND11_MODULE(_dawn4py, m) {
                                       UseNonTempCaches,
                                       KeepVarnames,
                                       PassVerbose,
+                                      PassTiming,
+                                      PassTimingTrace,
                                       ReportAccesses,
                                       DumpSplitGraphs,
                                       DumpStageGraph,
@@ -73,6 +93,7 @@ PYBIND11_MODULE(_dawn4py, m) {
                                       PrintStencilGraph,
                                       SetStageName,
                                       StageReordering,
+                                      StencilSplitting,
                                       StageMerger,
                                       TemporaryMerger,
                                       Inlining,
@@ -99,22 +120,30 @@ PYBIND11_MODULE(_dawn4py, m) {
                }),
            py::arg("max_blocks_per_sm") = 0, py::arg("nsms") = 0, py::arg("domain_size_i") = 0,
            py::arg("domain_size_j") = 0, py::arg("domain_size_k") = 0,
+           py::arg("loop_order") = "kji", py::arg("static_nbh_chains") = false,
+           py::arg("k_inner_loops") = false, py::arg("openmp_loops") = false,
+           py::arg("timers") = false,
            py::arg("backend") = "gridtools", py::arg("output_file") = "",
            py::arg("serialize_iir") = false, py::arg("deserialize_iir") = "",
-           py::arg("iir_format") = "json", py::arg("max_halo_points") = 3,
+           py::arg("iir_format") = "json", py::arg("cache_dir") = "",
+           py::arg("cache_max_size") = 256, py::arg("max_halo_points") = 3,
            py::arg("reorder_strategy") = "greedy", py::arg("max_fields_per_stencil") = 40,
            py::arg("max_cut_mss") = false, py::arg("block_size_i") = 0, py::arg("block_size_j") = 0,
-           py::arg("block_size_k") = 0, py::arg("split_stencils") = false,
+           py::arg("block_size_k") = 0, py::arg("block_size_cost_model") = false,
+           py::arg("hardware_config_file") = "", py::arg("optimizer_threads") = 1,
+           py::arg("split_stencils") = false,
            py::arg("merge_do_methods") = true, py::arg("use_parallel_ep") = false,
            py::arg("disable_k_caches") = false, py::arg("use_non_temp_caches") = false,
            py::arg("keep_varnames") = false, py::arg("pass_verbose") = false,
+           py::arg("pass_timing") = false, py::arg("pass_timing_trace") = "",
            py::arg("report_accesses") = false, py::arg("dump_split_graphs") = false,
            py::arg("dump_stage_graph") = false, py::arg("dump_temporary_graphs") = false,
            py::arg("dump_race_condition_graph") = false,
            py::arg("dump_stencil_instantiation") = false, py::arg("dump_stencil_graph") = false,
            py::arg("ssa") = false, py::arg("print_stencil_graph") = false,
            py::arg("set_stage_name") = false, py::arg("stage_reordering") = false,
-           py::arg("stage_merger") = false, py::arg("temporary_merger") = false,
+           py::arg("stencil_splitting") = false, py::arg("stage_merger") = false,
+           py::arg("temporary_merger") = false,
            py::arg("inlining") = false, py::arg("interval_partitioning") = false,
            py::arg("tmp_to_stencil_function") = false, py::arg("set_non_temp_caches") = false,
            py::arg("set_caches") = false, py::arg("set_block_size") = false,
@@ -136,11 +165,18 @@ PYBIND11_MODULE(_dawn4py, m) {
       .def_readwrite("domain_size_i", &dawn::Options::DomainSizeI)
       .def_readwrite("domain_size_j", &dawn::Options::DomainSizeJ)
       .def_readwrite("domain_size_k", &dawn::Options::DomainSizeK)
+      .def_readwrite("loop_order", &dawn::Options::LoopOrder)
+      .def_readwrite("static_nbh_chains", &dawn::Options::StaticNbhChains)
+      .def_readwrite("k_inner_loops", &dawn::Options::KInnerLoops)
+      .def_readwrite("openmp_loops", &dawn::Options::OpenMPLoops)
+      .def_readwrite("timers", &dawn::Options::Timers)
       .def_readwrite("backend", &dawn::Options::Backend)
       .def_readwrite("output_file", &dawn::Options::OutputFile)
       .def_readwrite("serialize_iir", &dawn::Options::SerializeIIR)
       .def_readwrite("deserialize_iir", &dawn::Options::DeserializeIIR)
       .def_readwrite("iir_format", &dawn::Options::IIRFormat)
+      .def_readwrite("cache_dir", &dawn::Options::CacheDir)
+      .def_readwrite("cache_max_size", &dawn::Options::CacheMaxSize)
       .def_readwrite("max_halo_points", &dawn::Options::MaxHaloPoints)
       .def_readwrite("reorder_strategy", &dawn::Options::ReorderStrategy)
       .def_readwrite("max_fields_per_stencil", &dawn::Options::MaxFieldsPerStencil)
@@ -148,6 +184,9 @@ PYBIND11_MODULE(_dawn4py, m) {
       .def_readwrite("block_size_i", &dawn::Options::BlockSizeI)
       .def_readwrite("block_size_j", &dawn::Options::BlockSizeJ)
       .def_readwrite("block_size_k", &dawn::Options::BlockSizeK)
+      .def_readwrite("block_size_cost_model", &dawn::Options::BlockSizeCostModel)
+      .def_readwrite("hardware_config_file", &dawn::Options::HardwareConfigFile)
+      .def_readwrite("optimizer_threads", &dawn::Options::OptimizerThreads)
       .def_readwrite("split_stencils", &dawn::Options::SplitStencils)
       .def_readwrite("merge_do_methods", &dawn::Options::MergeDoMethods)
       .def_readwrite("use_parallel_ep", &dawn::Options::UseParallelEP)
@@ -155,6 +194,8 @@ PYBIND11_MODULE(_dawn4py, m) {
       .def_readwrite("use_non_temp_caches", &dawn::Options::UseNonTempCaches)
       .def_readwrite("keep_varnames", &dawn::Options::KeepVarnames)
       .def_readwrite("pass_verbose", &dawn::Options::PassVerbose)
+      .def_readwrite("pass_timing", &dawn::Options::PassTiming)
+      .def_readwrite("pass_timing_trace", &dawn::Options::PassTimingTrace)
       .def_readwrite("report_accesses", &dawn::Options::ReportAccesses)
       .def_readwrite("dump_split_graphs", &dawn::Options::DumpSplitGraphs)
       .def_readwrite("dump_stage_graph", &dawn::Options::DumpStageGraph)
@@ -166,6 +207,7 @@ PYBIND11_MODULE(_dawn4py, m) {
       .def_readwrite("print_stencil_graph", &dawn::Options::PrintStencilGraph)
       .def_readwrite("set_stage_name", &dawn::Options::SetStageName)
       .def_readwrite("stage_reordering", &dawn::Options::StageReordering)
+      .def_readwrite("stencil_splitting", &dawn::Options::StencilSplitting)
       .def_readwrite("stage_merger", &dawn::Options::StageMerger)
       .def_readwrite("temporary_merger", &dawn::Options::TemporaryMerger)
       .def_readwrite("inlining", &dawn::Options::Inlining)
@@ -196,6 +238,13 @@ PYBIND11_MODULE(_dawn4py, m) {
            << "domain_size_i=" << self.DomainSizeI << ",\n    "
            << "domain_size_j=" << self.DomainSizeJ << ",\n    "
            << "domain_size_k=" << self.DomainSizeK << ",\n    "
+           << "loop_order="
+           << "\"" << self.LoopOrder << "\""
+           << ",\n    "
+           << "static_nbh_chains=" << self.StaticNbhChains << ",\n    "
+           << "k_inner_loops=" << self.KInnerLoops << ",\n    "
+           << "openmp_loops=" << self.OpenMPLoops << ",\n    "
+           << "timers=" << self.Timers << ",\n    "
            << "backend="
            << "\"" << self.Backend << "\""
            << ",\n    "
@@ -209,6 +258,10 @@ PYBIND11_MODULE(_dawn4py, m) {
            << "iir_format="
            << "\"" << self.IIRFormat << "\""
            << ",\n    "
+           << "cache_dir="
+           << "\"" << self.CacheDir << "\""
+           << ",\n    "
+           << "cache_max_size=" << self.CacheMaxSize << ",\n    "
            << "max_halo_points=" << self.MaxHaloPoints << ",\n    "
            << "reorder_strategy="
            << "\"" << self.ReorderStrategy << "\""
@@ -218,6 +271,11 @@ PYBIND11_MODULE(_dawn4py, m) {
            << "block_size_i=" << self.BlockSizeI << ",\n    "
            << "block_size_j=" << self.BlockSizeJ << ",\n    "
            << "block_size_k=" << self.BlockSizeK << ",\n    "
+           << "block_size_cost_model=" << self.BlockSizeCostModel << ",\n    "
+           << "hardware_config_file="
+           << "\"" << self.HardwareConfigFile << "\""
+           << ",\n    "
+           << "optimizer_threads=" << self.OptimizerThreads << ",\n    "
            << "split_stencils=" << self.SplitStencils << ",\n    "
            << "merge_do_methods=" << self.MergeDoMethods << ",\n    "
            << "use_parallel_ep=" << self.UseParallelEP << ",\n    "
@@ -225,6 +283,10 @@ PYBIND11_MODULE(_dawn4py, m) {
            << "use_non_temp_caches=" << self.UseNonTempCaches << ",\n    "
            << "keep_varnames=" << self.KeepVarnames << ",\n    "
            << "pass_verbose=" << self.PassVerbose << ",\n    "
+           << "pass_timing=" << self.PassTiming << ",\n    "
+           << "pass_timing_trace="
+           << "\"" << self.PassTimingTrace << "\""
+           << ",\n    "
            << "report_accesses=" << self.ReportAccesses << ",\n    "
            << "dump_split_graphs=" << self.DumpSplitGraphs << ",\n    "
            << "dump_stage_graph=" << self.DumpStageGraph << ",\n    "
@@ -236,6 +298,7 @@ PYBIND11_MODULE(_dawn4py, m) {
            << "print_stencil_graph=" << self.PrintStencilGraph << ",\n    "
            << "set_stage_name=" << self.SetStageName << ",\n    "
            << "stage_reordering=" << self.StageReordering << ",\n    "
+           << "stencil_splitting=" << self.StencilSplitting << ",\n    "
            << "stage_merger=" << self.StageMerger << ",\n    "
            << "temporary_merger=" << self.TemporaryMerger << ",\n    "
            << "inlining=" << self.Inlining << ",\n    "
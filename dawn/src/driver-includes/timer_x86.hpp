@@ -0,0 +1,54 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include "timer.hpp"
+
+namespace gridtools {
+namespace dawn {
+
+/**
+ * @class timer_x86
+ * Host implementation of the Timer interface based on std::chrono::steady_clock
+ */
+class timer_x86 : public timer<timer_x86> // CRTP
+{
+  std::chrono::steady_clock::time_point m_start;
+
+public:
+  timer_x86(std::string name) : timer<timer_x86>(name) {}
+
+  /**
+   * Reset counters
+   */
+  void set_impl(double) {}
+
+  /**
+   * Start the stop watch
+   */
+  void start_impl() { m_start = std::chrono::steady_clock::now(); }
+
+  /**
+   * Pause the stop watch
+   */
+  double pause_impl() {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+    return elapsed.count();
+  }
+};
+} // namespace dawn
+} // namespace gridtools
@@ -17,6 +17,12 @@
 #include "defs.hpp"
 #include "extent.hpp"
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
 namespace dawn {
 
 template <typename T>
@@ -61,6 +67,71 @@ using mesh_t = decltype(meshType(Tag{}));
 // a more appropriate place)
 enum class LocationType { Cells = 0, Edges, Vertices };
 
+// encodes a neighbor chain into an integer (two bits per location type, plus a leading one to
+// distinguish chains of different length). Interfaces may use it to key neighbor tables.
+inline uint64_t chainKey(std::vector<LocationType> const& chain) {
+  assert(chain.size() < 32);
+  uint64_t key = 1;
+  for(auto loc : chain) {
+    key = (key << 2) | uint64_t(loc);
+  }
+  return key;
+}
+
+template <LocationType... Chain>
+constexpr uint64_t chainKey() {
+  static_assert(sizeof...(Chain) < 32, "neighbor chain too long");
+  uint64_t key = 1;
+  for(auto loc : {Chain...}) {
+    key = (key << 2) | uint64_t(loc);
+  }
+  return key;
+}
+
+// location type of the elements a neighbor chain reduces over
+template <LocationType... Chain>
+constexpr LocationType chainTarget() {
+  static_assert(sizeof...(Chain) >= 2, "a neighbor chain needs at least two location types");
+  LocationType chain[] = {Chain...};
+  return chain[sizeof...(Chain) - 1];
+}
+
+// never defined, only makes `reduce<Chain...>(Tag{}, ...)` parse as a call to a function template
+// so that the interface overloads taking the chain as template arguments are found by ADL
+template <LocationType... Chain>
+void reduce();
+
+// the neighbors of one element along a chain, i.e. a row of a neighbor table. Interfaces return it
+// from getNeighborList, such that the neighbors can be looked up once and reduced over several
+// times, e.g. on every level of a column.
+struct NeighborList {
+  int const* first;
+  int const* last;
+
+  int const* begin() const { return first; }
+  int const* end() const { return last; }
+};
+
+// never defined, see reduce
+template <LocationType... Chain>
+void getNeighborList();
+
+template <typename Tag, typename Init, typename Op>
+Init reduce(Tag, NeighborList const& nbhs, Init init, Op&& op) {
+  for(int nbh : nbhs)
+    op(init, nbh);
+  return init;
+}
+
+template <typename Tag, typename Init, typename Op, typename Weights>
+Init reduce(Tag, NeighborList const& nbhs, Init init, Op&& op, Weights const& weights) {
+  assert(std::size_t(nbhs.end() - nbhs.begin()) <= weights.size());
+  int i = 0;
+  for(int nbh : nbhs)
+    op(init, nbh, weights[i++]);
+  return init;
+}
+
 // generic deref, specialize if needed
 template <typename Tag, typename LocationType>
 auto deref(Tag, LocationType const& l) -> LocationType const& {
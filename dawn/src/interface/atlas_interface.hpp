@@ -16,11 +16,20 @@
 #define DAWN_INTERFACE_ATLAS_INTERFACE_H_
 
 #include "atlas/mesh.h"
+#include "atlas/mesh/detail/MeshImpl.h"
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <tuple>
 #include <unordered_map>
 #include <variant>
@@ -56,6 +65,8 @@ public:
 
   iterator begin() const { return begin_; }
   iterator end() const { return end_; }
+  std::size_t size() const { return *end_ - *begin_; }
+  Integer operator[](std::size_t i) const { return *begin_ + i; }
   irange_(Integer begin, Integer end) : begin_(begin), end_(end) {}
 
 private:
@@ -270,17 +281,166 @@ std::vector<int> getNeighbors(atlas::Mesh const& mesh, std::vector<dawn::Locatio
   return resultUnique;
 }
 
+//===------------------------------------------------------------------------------------------===//
+// neighbor chain tables
+//===------------------------------------------------------------------------------------------===//
+
+// flat (CSR) neighbor table of a chain: the neighbors of element idx are
+// indices[offsets[idx]], ..., indices[offsets[idx + 1] - 1], in the order of getNeighbors
+struct NeighborTable {
+  std::vector<int> offsets;
+  std::vector<int> indices;
+};
+
+inline int numElements(atlas::Mesh const& mesh, dawn::LocationType loc) {
+  switch(loc) {
+  case dawn::LocationType::Cells:
+    return mesh.cells().size();
+  case dawn::LocationType::Edges:
+    return mesh.edges().size();
+  case dawn::LocationType::Vertices:
+    return mesh.nodes().size();
+  }
+  return 0;
+}
+
+inline NeighborTable buildNeighborTable(atlas::Mesh const& mesh,
+                                        std::vector<dawn::LocationType> const& chain) {
+  const int size = numElements(mesh, chain.front());
+  NeighborTable table;
+  table.offsets.reserve(size + 1);
+  table.offsets.push_back(0);
+  for(int idx = 0; idx < size; ++idx) {
+    auto neighs = getNeighbors(mesh, chain, idx);
+    table.indices.insert(table.indices.end(), neighs.begin(), neighs.end());
+    table.offsets.push_back(table.indices.size());
+  }
+  return table;
+}
+
+// Tables are built on first use of a chain on a mesh and dropped when the mesh is destroyed, the
+// cache is notified through the observer mechanism of atlas. Hence the tables of a mesh are never
+// handed out for a new mesh at the same address. Atlas does not notify us if the connectivity of a
+// mesh changes though, a mesh that is modified after it has been used in a reduction needs to be
+// invalidated explicitly.
+class NeighborTableCache {
+public:
+  // returns the table of the chain with the given key, build is only called if the table is missing
+  NeighborTable const& get(atlas::Mesh const& mesh, uint64_t chain,
+                           std::function<NeighborTable()> const& build) {
+    TableKey key{mesh.get(), chain};
+    {
+      // lookups happen in every reduction, possibly from many threads at once
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      auto it = tables_.find(key);
+      if(it != tables_.end())
+        return it->second;
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = tables_.find(key);
+    if(it == tables_.end()) {
+      if(!observers_.count(mesh.get()))
+        observers_.emplace(mesh.get(), std::make_unique<Observer>(*this, *mesh.get()));
+      it = tables_.emplace(key, build()).first;
+    }
+    return it->second;
+  }
+
+  void invalidate(atlas::Mesh const& mesh) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    erase(mesh.get());
+  }
+
+private:
+  using MeshImpl = atlas::mesh::detail::MeshImpl;
+  using TableKey = std::tuple<const MeshImpl*, uint64_t>;
+
+  // Every mesh gets an observer of its own. Atlas unregisters an observer from the destroyed mesh
+  // after notifying it, i.e. outside of the lock of the cache. With a private observer that call
+  // can not race with the registration of other meshes.
+  class Observer : public atlas::mesh::detail::MeshObserver {
+  public:
+    Observer(NeighborTableCache& cache, MeshImpl const& mesh) : cache_(cache) {
+      registerMesh(mesh);
+    }
+    void onMeshDestruction(MeshImpl& mesh) override { cache_.onMeshDestruction(mesh); }
+
+  private:
+    NeighborTableCache& cache_;
+  };
+
+  void onMeshDestruction(MeshImpl const& mesh) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    erase(&mesh);
+    // atlas still uses the observer once the notification returns, it is released with the cache
+    auto it = observers_.find(&mesh);
+    if(it != observers_.end()) {
+      retiredObservers_.push_back(std::move(it->second));
+      observers_.erase(it);
+    }
+  }
+
+  void erase(const MeshImpl* mesh) {
+    // the tables of a mesh are adjacent in the map
+    tables_.erase(tables_.lower_bound(TableKey{mesh, 0}),
+                  tables_.upper_bound(TableKey{mesh, std::numeric_limits<uint64_t>::max()}));
+  }
+
+  // std::map keeps references to tables stable while other tables are inserted
+  std::map<TableKey, NeighborTable> tables_;
+  std::map<const MeshImpl*, std::unique_ptr<Observer>> observers_;
+  std::vector<std::unique_ptr<Observer>> retiredObservers_;
+  std::shared_mutex mutex_;
+};
+
+inline NeighborTableCache& neighborTableCache() {
+  static NeighborTableCache cache;
+  return cache;
+}
+
+inline NeighborTable const& getNeighborTable(atlas::Mesh const& mesh,
+                                             std::vector<dawn::LocationType> const& chain) {
+  return neighborTableCache().get(mesh, dawn::chainKey(chain),
+                                  [&] { return buildNeighborTable(mesh, chain); });
+}
+
+template <dawn::LocationType... Chain>
+NeighborTable const& getNeighborTable(atlas::Mesh const& mesh) {
+  return neighborTableCache().get(mesh, dawn::chainKey<Chain...>(), [&] {
+    return buildNeighborTable(mesh, std::vector<dawn::LocationType>{Chain...});
+  });
+}
+
+inline void invalidateNeighborTables(atlas::Mesh const& mesh) {
+  neighborTableCache().invalidate(mesh);
+}
+
+inline dawn::NeighborList getNeighborRow(NeighborTable const& table, int idx) {
+  return {table.indices.data() + table.offsets[idx], table.indices.data() + table.offsets[idx + 1]};
+}
+
+inline dawn::NeighborList getNeighborList(atlasTag, atlas::Mesh const& m, int idx,
+                                          std::vector<dawn::LocationType> const& chain) {
+  return getNeighborRow(getNeighborTable(m, chain), idx);
+}
+
+template <dawn::LocationType... Chain>
+dawn::NeighborList getNeighborList(atlasTag, atlas::Mesh const& m, int idx) {
+  return getNeighborRow(getNeighborTable<Chain...>(m), idx);
+}
+
 //===------------------------------------------------------------------------------------------===//
 // weighted version
 //===------------------------------------------------------------------------------------------===//
 
 template <typename Init, typename Op, typename WeightT>
 auto reduce(atlasTag, atlas::Mesh const& m, int idx, Init init,
-            std::vector<dawn::LocationType> chain, Op&& op, std::vector<WeightT>&& weights) {
+            std::vector<dawn::LocationType> const& chain, Op&& op,
+            std::vector<WeightT>&& weights) {
   static_assert(std::is_arithmetic<WeightT>::value, "weights need to be of arithmetic type!\n");
-  int i = 0;
-  for(auto&& objIdx : getNeighbors(m, chain, idx))
-    op(init, objIdx, weights[i++]);
+  NeighborTable const& table = getNeighborTable(m, chain);
+  for(int n = table.offsets[idx], i = 0; n < table.offsets[idx + 1]; ++n, ++i)
+    op(init, table.indices[n], weights[i]);
   return init;
 }
 
@@ -290,9 +450,33 @@ auto reduce(atlasTag, atlas::Mesh const& m, int idx, Init init,
 
 template <typename Init, typename Op>
 auto reduce(atlasTag, atlas::Mesh const& m, int idx, Init init,
-            std::vector<dawn::LocationType> chain, Op&& op) {
-  for(auto&& objIdx : getNeighbors(m, chain, idx))
-    op(init, objIdx);
+            std::vector<dawn::LocationType> const& chain, Op&& op) {
+  NeighborTable const& table = getNeighborTable(m, chain);
+  for(int n = table.offsets[idx]; n < table.offsets[idx + 1]; ++n)
+    op(init, table.indices[n]);
+  return init;
+}
+
+//===------------------------------------------------------------------------------------------===//
+// versions with the neighbor chain known at compile time
+//===------------------------------------------------------------------------------------------===//
+
+template <dawn::LocationType... Chain, typename Init, typename Op, typename WeightT, size_t N>
+auto reduce(atlasTag, atlas::Mesh const& m, int idx, Init init, Op&& op,
+            std::array<WeightT, N> const& weights) {
+  static_assert(std::is_arithmetic<WeightT>::value, "weights need to be of arithmetic type!\n");
+  NeighborTable const& table = getNeighborTable<Chain...>(m);
+  assert(table.offsets[idx + 1] - table.offsets[idx] <= int(N));
+  for(int n = table.offsets[idx], i = 0; n < table.offsets[idx + 1]; ++n, ++i)
+    op(init, table.indices[n], weights[i]);
+  return init;
+}
+
+template <dawn::LocationType... Chain, typename Init, typename Op>
+auto reduce(atlasTag, atlas::Mesh const& m, int idx, Init init, Op&& op) {
+  NeighborTable const& table = getNeighborTable<Chain...>(m);
+  for(int n = table.offsets[idx]; n < table.offsets[idx + 1]; ++n)
+    op(init, table.indices[n]);
   return init;
 }
 
@@ -17,6 +17,7 @@
 #include "../driver-includes/unstructured_interface.hpp"
 #include "../toylib/toylib.hpp"
 
+#include <array>
 #include <assert.h>
 #include <functional>
 #include <list>
@@ -28,7 +29,7 @@ namespace toylibInterface {
 struct toylibTag {};
 
 toylib::Grid meshType(toylibTag);
-const toylib::ToylibElement* indexType(toylibTag);
+int indexType(toylibTag);
 template <typename T>
 toylib::FaceData<T> cellFieldType(toylibTag);
 template <typename T>
@@ -45,29 +46,11 @@ toylib::SparseVertexData<T> sparseVertexFieldType(toylibTag);
 
 using Mesh = toylib::Grid;
 
-inline std::vector<const toylib::ToylibElement*> getCells(toylibTag, toylib::Grid const& m) {
-  std::vector<const toylib::ToylibElement*> ret;
-  std::transform(m.faces().begin(), m.faces().end(), std::back_inserter(ret),
-                 [](const toylib::Face& in) -> const toylib::ToylibElement* {
-                   return static_cast<const toylib::ToylibElement*>(&in);
-                 });
-  return ret;
-}
-inline std::vector<const toylib::ToylibElement*> getEdges(toylibTag, toylib::Grid const& m) {
-  std::vector<const toylib::ToylibElement*> ret;
-  std::transform(m.edges().begin(), m.edges().end(), std::back_inserter(ret),
-                 [](const toylib::Edge& in) -> const toylib::ToylibElement* {
-                   return static_cast<const toylib::ToylibElement*>(&in);
-                 });
-  return ret;
-}
-inline std::vector<const toylib::ToylibElement*> getVertices(toylibTag, toylib::Grid const& m) {
-  std::vector<const toylib::ToylibElement*> ret;
-  std::transform(m.vertices().begin(), m.vertices().end(), std::back_inserter(ret),
-                 [](const toylib::Vertex& in) -> const toylib::ToylibElement* {
-                   return static_cast<const toylib::ToylibElement*>(&in);
-                 });
-  return ret;
+// elements are iterated by their ids, fields and reductions accept ids as well as elements
+inline toylib::index_range getCells(toylibTag, toylib::Grid const& m) { return m.face_ids(); }
+inline std::vector<int> const& getEdges(toylibTag, toylib::Grid const& m) { return m.edge_ids(); }
+inline toylib::index_range getVertices(toylibTag, toylib::Grid const& m) {
+  return m.vertex_ids();
 }
 
 // Specialized to deref the reference_wrapper
@@ -269,53 +252,191 @@ inline std::vector<const toylib::ToylibElement*> getNeighbors(const toylib::Grid
   return resultUnique;
 }
 
+//===------------------------------------------------------------------------------------------===//
+// neighbor chain tables
+//===------------------------------------------------------------------------------------------===//
+
+// elements of a location type, indexed by their id
+template <dawn::LocationType>
+struct location_traits;
+template <>
+struct location_traits<dawn::LocationType::Cells> {
+  static std::vector<toylib::Face> const& elements(toylib::Grid const& grid) {
+    return grid.faces();
+  }
+};
+template <>
+struct location_traits<dawn::LocationType::Edges> {
+  static std::vector<toylib::Edge> const& elements(toylib::Grid const& grid) {
+    return grid.all_edges();
+  }
+};
+template <>
+struct location_traits<dawn::LocationType::Vertices> {
+  static std::vector<toylib::Vertex> const& elements(toylib::Grid const& grid) {
+    return grid.vertices();
+  }
+};
+
+inline toylib::NeighborTable buildNeighborTable(toylib::Grid const& grid,
+                                                std::vector<dawn::LocationType> const& chain) {
+  toylib::NeighborTable table;
+  table.offsets.push_back(0);
+  auto addRows = [&](auto const& elems) {
+    for(auto const& elem : elems) {
+      for(auto nbh : getNeighbors(grid, chain, &elem))
+        table.indices.push_back(nbh->id());
+      table.offsets.push_back(table.indices.size());
+    }
+  };
+  switch(chain.front()) {
+  case dawn::LocationType::Cells:
+    addRows(grid.faces());
+    break;
+  case dawn::LocationType::Edges:
+    addRows(grid.all_edges());
+    break;
+  case dawn::LocationType::Vertices:
+    addRows(grid.vertices());
+    break;
+  }
+  return table;
+}
+
+inline toylib::NeighborTable const& getNeighborTable(toylib::Grid const& grid,
+                                                     std::vector<dawn::LocationType> const& chain) {
+  return grid.neighbor_table(dawn::chainKey(chain),
+                             [&] { return buildNeighborTable(grid, chain); });
+}
+
+template <dawn::LocationType... Chain>
+toylib::NeighborTable const& getNeighborTable(toylib::Grid const& grid) {
+  return grid.neighbor_table(dawn::chainKey<Chain...>(),
+                             [&] { return buildNeighborTable(grid, {Chain...}); });
+}
+
+inline dawn::NeighborList getNeighborRow(toylib::NeighborTable const& table, int idx) {
+  return {table.indices.data() + table.offsets[idx], table.indices.data() + table.offsets[idx + 1]};
+}
+
+inline dawn::NeighborList getNeighborList(toylibTag, toylib::Grid const& grid, int idx,
+                                          std::vector<dawn::LocationType> const& chain) {
+  return getNeighborRow(getNeighborTable(grid, chain), idx);
+}
+
+template <dawn::LocationType... Chain>
+dawn::NeighborList getNeighborList(toylibTag, toylib::Grid const& grid, int idx) {
+  return getNeighborRow(getNeighborTable<Chain...>(grid), idx);
+}
+
+// applies op to the neighbors of the element with id idx listed in table
+template <typename Elem, typename Init, typename Op>
+Init reduceOverTable(std::vector<Elem> const& elems, toylib::NeighborTable const& table, int idx,
+                     Init init, Op&& op) {
+  for(int n = table.offsets[idx]; n < table.offsets[idx + 1]; ++n)
+    op(init, &elems[table.indices[n]]);
+  return init;
+}
+
+template <typename Elem, typename Init, typename Op, typename Weights>
+Init reduceOverTable(std::vector<Elem> const& elems, toylib::NeighborTable const& table, int idx,
+                     Init init, Op&& op, Weights const& weights) {
+  for(int n = table.offsets[idx], i = 0; n < table.offsets[idx + 1]; ++n, ++i)
+    op(init, &elems[table.indices[n]], weights[i]);
+  return init;
+}
+
+// applies op to the ids of the neighbors of the element with id idx listed in table
+template <typename Init, typename Op>
+Init reduceOverIds(toylib::NeighborTable const& table, int idx, Init init, Op&& op) {
+  for(int n = table.offsets[idx]; n < table.offsets[idx + 1]; ++n)
+    op(init, table.indices[n]);
+  return init;
+}
+
+template <typename Init, typename Op, typename Weights>
+Init reduceOverIds(toylib::NeighborTable const& table, int idx, Init init, Op&& op,
+                   Weights const& weights) {
+  for(int n = table.offsets[idx], i = 0; n < table.offsets[idx + 1]; ++n, ++i)
+    op(init, table.indices[n], weights[i]);
+  return init;
+}
+
 //===------------------------------------------------------------------------------------------===//
 // unweighted version
 //===------------------------------------------------------------------------------------------===//
 
 template <typename Init, typename Op>
 auto reduce(toylibTag, toylib::Grid const& grid, toylib::ToylibElement const* idx, Init init,
-            std::vector<dawn::LocationType> chain, Op&& op) {
-  for(auto ptr : getNeighbors(grid, chain, idx)) {
-    switch(chain.back()) {
-    case dawn::LocationType::Cells:
-      op(init, static_cast<const toylib::Face*>(ptr));
-      break;
-    case dawn::LocationType::Edges:
-      op(init, static_cast<const toylib::Edge*>(ptr));
-      break;
-    case dawn::LocationType::Vertices:
-      op(init, static_cast<const toylib::Vertex*>(ptr));
-      break;
-    }
+            std::vector<dawn::LocationType> const& chain, Op&& op) {
+  toylib::NeighborTable const& table = getNeighborTable(grid, chain);
+  switch(chain.back()) {
+  case dawn::LocationType::Cells:
+    return reduceOverTable(grid.faces(), table, idx->id(), init, op);
+  case dawn::LocationType::Edges:
+    return reduceOverTable(grid.all_edges(), table, idx->id(), init, op);
+  case dawn::LocationType::Vertices:
+    return reduceOverTable(grid.vertices(), table, idx->id(), init, op);
   }
-
   return init;
 }
 
+// chain known at compile time, e.g. reduce<Edges, Cells>(...)
+template <dawn::LocationType... Chain, typename Init, typename Op>
+Init reduce(toylibTag, toylib::Grid const& grid, toylib::ToylibElement const* idx, Init init,
+            Op&& op) {
+  return reduceOverTable(location_traits<dawn::chainTarget<Chain...>()>::elements(grid),
+                         getNeighborTable<Chain...>(grid), idx->id(), init, op);
+}
+
+// element given by its id, op is called with the ids of the neighbors
+template <typename Init, typename Op>
+auto reduce(toylibTag, toylib::Grid const& grid, int idx, Init init,
+            std::vector<dawn::LocationType> const& chain, Op&& op) {
+  return reduceOverIds(getNeighborTable(grid, chain), idx, init, op);
+}
+
+template <dawn::LocationType... Chain, typename Init, typename Op>
+Init reduce(toylibTag, toylib::Grid const& grid, int idx, Init init, Op&& op) {
+  return reduceOverIds(getNeighborTable<Chain...>(grid), idx, init, op);
+}
+
 //===------------------------------------------------------------------------------------------===//
 // weighted version
 //===------------------------------------------------------------------------------------------===//
 
 template <typename Init, typename Op, typename Weight>
 auto reduce(toylibTag, toylib::Grid const& grid, toylib::ToylibElement const* idx, Init init,
-            std::vector<dawn::LocationType> chain, Op&& op, std::vector<Weight>&& weights) {
-  int i = 0;
-  for(auto ptr : getNeighbors(grid, chain, idx)) {
-    switch(chain.back()) {
-    case dawn::LocationType::Cells:
-      op(init, static_cast<const toylib::Face*>(ptr), weights[i++]);
-      break;
-    case dawn::LocationType::Edges:
-      op(init, static_cast<const toylib::Edge*>(ptr), weights[i++]);
-      break;
-    case dawn::LocationType::Vertices:
-      op(init, static_cast<const toylib::Vertex*>(ptr), weights[i++]);
-      break;
-    }
+            std::vector<dawn::LocationType> const& chain, Op&& op, std::vector<Weight>&& weights) {
+  toylib::NeighborTable const& table = getNeighborTable(grid, chain);
+  switch(chain.back()) {
+  case dawn::LocationType::Cells:
+    return reduceOverTable(grid.faces(), table, idx->id(), init, op, weights);
+  case dawn::LocationType::Edges:
+    return reduceOverTable(grid.all_edges(), table, idx->id(), init, op, weights);
+  case dawn::LocationType::Vertices:
+    return reduceOverTable(grid.vertices(), table, idx->id(), init, op, weights);
   }
-
   return init;
 }
 
-} // namespace toylibInterface
\ No newline at end of file
+template <dawn::LocationType... Chain, typename Init, typename Op, typename Weight, size_t N>
+Init reduce(toylibTag, toylib::Grid const& grid, toylib::ToylibElement const* idx, Init init,
+            Op&& op, std::array<Weight, N> const& weights) {
+  return reduceOverTable(location_traits<dawn::chainTarget<Chain...>()>::elements(grid),
+                         getNeighborTable<Chain...>(grid), idx->id(), init, op, weights);
+}
+
+template <typename Init, typename Op, typename Weight>
+auto reduce(toylibTag, toylib::Grid const& grid, int idx, Init init,
+            std::vector<dawn::LocationType> const& chain, Op&& op, std::vector<Weight>&& weights) {
+  return reduceOverIds(getNeighborTable(grid, chain), idx, init, op, weights);
+}
+
+template <dawn::LocationType... Chain, typename Init, typename Op, typename Weight, size_t N>
+Init reduce(toylibTag, toylib::Grid const& grid, int idx, Init init, Op&& op,
+            std::array<Weight, N> const& weights) {
+  return reduceOverIds(getNeighborTable<Chain...>(grid), idx, init, op, weights);
+}
+
+} // namespace toylibInterface
@@ -58,6 +58,44 @@ std::vector<const Face*> Face::faces() const {
 Vertex const& Edge::vertex(size_t i) const { return *vertices_[i]; }
 Face const& Edge::face(size_t i) const { return *faces_[i]; }
 
+NeighborTable const& Grid::neighbor_table(uint64_t chain,
+                                          std::function<NeighborTable()> const& build) const {
+  {
+    // lookups happen in every reduction, possibly from many threads at once
+    std::shared_lock<std::shared_mutex> lock(neighbor_tables_->mutex);
+    auto it = neighbor_tables_->tables.find(chain);
+    if(it != neighbor_tables_->tables.end())
+      return it->second;
+  }
+  std::unique_lock<std::shared_mutex> lock(neighbor_tables_->mutex);
+  auto it = neighbor_tables_->tables.find(chain);
+  if(it == neighbor_tables_->tables.end())
+    it = neighbor_tables_->tables.emplace(chain, build()).first;
+  return it->second;
+}
+
+void Grid::build_connectivity_tables() {
+  auto fill = [](auto& table, auto const& elems, auto neighbors) {
+    table = std::decay_t<decltype(table)>(elems.size());
+    for(auto const& elem : elems) {
+      if(elem.id() < 0)
+        continue;
+      int i = 0;
+      for(auto nbh : neighbors(elem))
+        table(elem.id(), i++) = nbh->id();
+    }
+  };
+  fill(face_edge_, faces_, [](Face const& f) { return f.edges(); });
+  fill(face_vertex_, faces_, [](Face const& f) { return f.vertices(); });
+  fill(edge_face_, edges_, [](Edge const& e) { return e.faces(); });
+  fill(edge_vertex_, edges_, [](Edge const& e) { return e.vertices(); });
+  fill(vertex_edge_, vertices_, [](Vertex const& v) { return v.edges(); });
+  fill(vertex_face_, vertices_, [](Vertex const& v) { return v.faces(); });
+
+  for(Edge const& e : valid_edges_)
+    valid_edge_ids_.push_back(e.id());
+}
+
 int count_inner_faces(Grid const& grid) {
   int fcnt = 0;
   for(const auto& f : grid.faces()) {
@@ -16,8 +16,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
 #include <vector>
 
 namespace toylib {
@@ -125,6 +131,67 @@ private:
   std::vector<Face*> faces_;
 };
 
+// fixed width connectivity table in struct-of-arrays form: neighbor i of the element with id idx
+// is (*this)(idx, i). Rows with less than Width neighbors are padded with -1.
+template <int Width>
+class connectivity_table {
+public:
+  static constexpr int width = Width;
+
+  connectivity_table() = default;
+  explicit connectivity_table(size_t size) : table_(size * Width, -1) {}
+
+  int operator()(int idx, int i) const { return table_[idx * Width + i]; }
+  int& operator()(int idx, int i) { return table_[idx * Width + i]; }
+  size_t size() const { return table_.size() / Width; }
+
+private:
+  std::vector<int> table_;
+};
+
+// range of element ids [begin, end)
+class index_range {
+public:
+  class iterator {
+  public:
+    int operator*() const { return i_; }
+    const iterator& operator++() {
+      ++i_;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator copy(*this);
+      ++i_;
+      return copy;
+    }
+
+    bool operator==(const iterator& other) const { return i_ == other.i_; }
+    bool operator!=(const iterator& other) const { return i_ != other.i_; }
+
+    iterator(int start) : i_(start) {}
+
+  private:
+    int i_;
+  };
+
+  index_range(int begin, int end) : begin_(begin), end_(end) {}
+  iterator begin() const { return begin_; }
+  iterator end() const { return end_; }
+  size_t size() const { return *end_ - *begin_; }
+  int operator[](size_t i) const { return *begin_ + i; }
+
+private:
+  iterator begin_;
+  iterator end_;
+};
+
+// neighbor table in CSR format: the neighbors of the element with id idx are
+// indices[offsets[idx]], ..., indices[offsets[idx + 1] - 1]
+struct NeighborTable {
+  std::vector<int> offsets;
+  std::vector<int> indices;
+};
+
 class Grid {
 public:
   // generates a grid of right triangles, vertices are in [0,1] x [0,1]
@@ -336,6 +403,8 @@ public:
         e.swap();
       }
     }
+
+    build_connectivity_tables();
   }
 
   std::vector<Face> const& faces() const { return faces_; }
@@ -344,19 +413,93 @@ public:
   std::vector<std::reference_wrapper<Edge const>> const& edges() const { return valid_edges_; }
   std::vector<Edge> const& all_edges() const { return edges_; }
 
+  // ids of the faces, vertices and edges in the domain
+  index_range face_ids() const { return index_range(0, faces_.size()); }
+  index_range vertex_ids() const { return index_range(0, vertices_.size()); }
+  std::vector<int> const& edge_ids() const { return valid_edge_ids_; }
+
+  // connectivity in struct-of-arrays form, indexed by element ids. Neighbors are listed in the
+  // same order as by the element objects.
+  connectivity_table<3> const& face_edge_table() const { return face_edge_; }
+  connectivity_table<3> const& face_vertex_table() const { return face_vertex_; }
+  connectivity_table<2> const& edge_face_table() const { return edge_face_; }
+  connectivity_table<2> const& edge_vertex_table() const { return edge_vertex_; }
+  connectivity_table<6> const& vertex_edge_table() const { return vertex_edge_; }
+  connectivity_table<6> const& vertex_face_table() const { return vertex_face_; }
+
   auto nx() const { return nx_; }
   auto ny() const { return ny_; }
 
+  // neighbor table of the chain encoded by `chain`, computed by `build` on the first request. The
+  // topology of a grid does not change after construction, hence tables are never invalidated.
+  NeighborTable const& neighbor_table(uint64_t chain,
+                                      std::function<NeighborTable()> const& build) const;
+
 private:
+  void build_connectivity_tables();
+
+  struct NeighborTableCache {
+    std::shared_mutex mutex;
+    std::map<uint64_t, NeighborTable> tables;
+  };
+
   std::vector<Face> faces_;
   std::vector<Vertex> vertices_;
   std::vector<Edge> edges_;
   std::vector<std::reference_wrapper<Edge const>> valid_edges_;
+  std::vector<int> valid_edge_ids_;
+
+  connectivity_table<3> face_edge_;
+  connectivity_table<3> face_vertex_;
+  connectivity_table<2> edge_face_;
+  connectivity_table<2> edge_vertex_;
+  connectivity_table<6> vertex_edge_;
+  connectivity_table<6> vertex_face_;
+  std::shared_ptr<NeighborTableCache> neighbor_tables_ = std::make_shared<NeighborTableCache>();
 
   int nx_;
   int ny_;
 }; // namespace mylib
 
+//===------------------------------------------------------------------------------------------===//
+// field storage
+//===------------------------------------------------------------------------------------------===//
+
+// memory layout of the values of a field. With horizontal_major each k-level is contiguous, with
+// k_major each column is. The sparse dimension of sparse fields is always the innermost one.
+enum class storage_layout { horizontal_major, k_major };
+
+// allocator returning memory aligned to cache lines, such that loops over a field vectorize
+template <typename T, std::size_t Alignment = 64>
+struct aligned_allocator {
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alignment>;
+  };
+
+  aligned_allocator() = default;
+  template <typename U>
+  aligned_allocator(aligned_allocator<U, Alignment> const&) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+  }
+  void deallocate(T* p, std::size_t) { ::operator delete(p, std::align_val_t(Alignment)); }
+
+  template <typename U>
+  bool operator==(aligned_allocator<U, Alignment> const&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(aligned_allocator<U, Alignment> const&) const {
+    return false;
+  }
+};
+
+template <typename T>
+using aligned_vector = std::vector<T, aligned_allocator<T>>;
+
 //===------------------------------------------------------------------------------------------===//
 // dense fields
 //===------------------------------------------------------------------------------------------===//
@@ -364,39 +507,63 @@ private:
 template <typename O, typename T>
 class Data {
 public:
-  Data(size_t horizontal_size, size_t num_k_levels)
-      : data_(num_k_levels, std::vector<T>(horizontal_size)) {}
-  T& operator()(O const& f, size_t k_level) { return data_[k_level][f.id()]; }
-  T const& operator()(O const& f, size_t k_level) const { return data_[k_level][f.id()]; }
+  Data(size_t horizontal_size, size_t num_k_levels,
+       storage_layout layout = storage_layout::horizontal_major)
+      : k_size_(num_k_levels), layout_(layout),
+        horizontal_stride_(layout == storage_layout::horizontal_major ? 1 : num_k_levels),
+        k_stride_(layout == storage_layout::horizontal_major ? horizontal_size : 1),
+        data_(horizontal_size * num_k_levels) {}
+  T& operator()(O const& f, size_t k_level) { return data_[index(f.id(), k_level)]; }
+  T const& operator()(O const& f, size_t k_level) const { return data_[index(f.id(), k_level)]; }
   T& operator()(ToylibElement const* f, size_t k_level) {
-    return data_[k_level][static_cast<const O*>(f)->id()];
+    return data_[index(static_cast<const O*>(f)->id(), k_level)];
   }
   T const& operator()(ToylibElement const* f, size_t k_level) const {
-    return data_[k_level][static_cast<const O*>(f)->id()];
+    return data_[index(static_cast<const O*>(f)->id(), k_level)];
   }
+  T& operator()(int id, size_t k_level) { return data_[index(id, k_level)]; }
+  T const& operator()(int id, size_t k_level) const { return data_[index(id, k_level)]; }
+  // iterate over all values, in the order they are stored
   auto begin() { return data_.begin(); }
   auto end() { return data_.end(); }
 
-  int k_size() const { return data_.size(); }
+  T* data() { return data_.data(); }
+  T const* data() const { return data_.data(); }
+  size_t size() const { return data_.size(); }
+
+  int k_size() const { return k_size_; }
+  storage_layout layout() const { return layout_; }
 
 private:
-  std::vector<std::vector<T>> data_;
+  size_t index(size_t horizontal_idx, size_t k_level) const {
+    return horizontal_idx * horizontal_stride_ + k_level * k_stride_;
+  }
+
+  size_t k_size_;
+  storage_layout layout_;
+  size_t horizontal_stride_;
+  size_t k_stride_;
+  aligned_vector<T> data_;
 };
 
 template <typename T>
 class FaceData : public Data<Face, T> {
 public:
-  FaceData(Grid const& grid, int k_size) : Data<Face, T>(grid.faces().size(), k_size) {}
+  FaceData(Grid const& grid, int k_size, storage_layout layout = storage_layout::horizontal_major)
+      : Data<Face, T>(grid.faces().size(), k_size, layout) {}
 };
 template <typename T>
 class VertexData : public Data<Vertex, T> {
 public:
-  VertexData(Grid const& grid, int k_size) : Data<Vertex, T>(grid.vertices().size(), k_size) {}
+  VertexData(Grid const& grid, int k_size,
+             storage_layout layout = storage_layout::horizontal_major)
+      : Data<Vertex, T>(grid.vertices().size(), k_size, layout) {}
 };
 template <typename T>
 class EdgeData : public Data<Edge, T> {
 public:
-  EdgeData(Grid const& grid, int k_size) : Data<Edge, T>(grid.all_edges().size(), k_size) {}
+  EdgeData(Grid const& grid, int k_size, storage_layout layout = storage_layout::horizontal_major)
+      : Data<Edge, T>(grid.all_edges().size(), k_size, layout) {}
 };
 
 //===------------------------------------------------------------------------------------------===//
@@ -406,43 +573,72 @@ public:
 template <typename O, typename T>
 class SparseData {
 public:
-  SparseData(size_t num_k_levels, size_t dense_size, size_t sparse_size)
-      : data_(num_k_levels, std::vector<std::vector<T>>(dense_size, std::vector<T>(sparse_size))) {}
+  SparseData(size_t num_k_levels, size_t dense_size, size_t sparse_size,
+             storage_layout layout = storage_layout::horizontal_major)
+      : k_size_(num_k_levels), layout_(layout),
+        horizontal_stride_(layout == storage_layout::horizontal_major ? sparse_size
+                                                                      : num_k_levels * sparse_size),
+        k_stride_(layout == storage_layout::horizontal_major ? dense_size * sparse_size
+                                                             : sparse_size),
+        data_(num_k_levels * dense_size * sparse_size) {}
   T& operator()(const O& elem, size_t sparse_idx, size_t k_level) {
-    return data_[k_level][elem.id()][sparse_idx];
+    return data_[index(elem.id(), sparse_idx, k_level)];
   }
   T const& operator()(const O& elem, size_t sparse_idx, size_t k_level) const {
-    return data_[k_level][elem.id()][sparse_idx];
+    return data_[index(elem.id(), sparse_idx, k_level)];
   }
   T& operator()(ToylibElement const* elem, size_t sparse_idx, size_t k_level) {
-    return data_[k_level][static_cast<const O*>(elem)->id()][sparse_idx];
+    return data_[index(static_cast<const O*>(elem)->id(), sparse_idx, k_level)];
   }
   T const& operator()(ToylibElement const* elem, size_t sparse_idx, size_t k_level) const {
-    return data_[k_level][static_cast<const O*>(elem)->id()][sparse_idx];
+    return data_[index(static_cast<const O*>(elem)->id(), sparse_idx, k_level)];
+  }
+  T& operator()(int id, size_t sparse_idx, size_t k_level) {
+    return data_[index(id, sparse_idx, k_level)];
   }
-  int k_size() const { return data_.size(); }
+  T const& operator()(int id, size_t sparse_idx, size_t k_level) const {
+    return data_[index(id, sparse_idx, k_level)];
+  }
+
+  T* data() { return data_.data(); }
+  T const* data() const { return data_.data(); }
+  size_t size() const { return data_.size(); }
+
+  int k_size() const { return k_size_; }
+  storage_layout layout() const { return layout_; }
 
 private:
-  std::vector<std::vector<std::vector<T>>> data_;
+  size_t index(size_t horizontal_idx, size_t sparse_idx, size_t k_level) const {
+    return horizontal_idx * horizontal_stride_ + k_level * k_stride_ + sparse_idx;
+  }
+
+  size_t k_size_;
+  storage_layout layout_;
+  size_t horizontal_stride_;
+  size_t k_stride_;
+  aligned_vector<T> data_;
 };
 
 template <typename T>
 class SparseFaceData : public SparseData<Face, T> {
 public:
-  SparseFaceData(Grid const& grid, int k_size, int sparse_size)
-      : SparseData<Face, T>(k_size, grid.faces().size(), sparse_size) {}
+  SparseFaceData(Grid const& grid, int k_size, int sparse_size,
+                 storage_layout layout = storage_layout::horizontal_major)
+      : SparseData<Face, T>(k_size, grid.faces().size(), sparse_size, layout) {}
 };
 template <typename T>
 class SparseVertexData : public SparseData<Vertex, T> {
 public:
-  SparseVertexData(Grid const& grid, int k_size, int sparse_size)
-      : SparseData<Vertex, T>(k_size, grid.vertices().size(), sparse_size) {}
+  SparseVertexData(Grid const& grid, int k_size, int sparse_size,
+                   storage_layout layout = storage_layout::horizontal_major)
+      : SparseData<Vertex, T>(k_size, grid.vertices().size(), sparse_size, layout) {}
 };
 template <typename T>
 class SparseEdgeData : public SparseData<Edge, T> {
 public:
-  SparseEdgeData(Grid const& grid, int k_size, int sparse_size)
-      : SparseData<Edge, T>(k_size, grid.all_edges().size(), sparse_size) {}
+  SparseEdgeData(Grid const& grid, int k_size, int sparse_size,
+                 storage_layout layout = storage_layout::horizontal_major)
+      : SparseData<Edge, T>(k_size, grid.all_edges().size(), sparse_size, layout) {}
 };
 
 std::ostream& toVtk(Grid const& grid, int k_size, std::ostream& os = std::cout);
@@ -0,0 +1,294 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/CodeGen/TranslationUnit.h"
+#include "dawn/Compiler/DawnCompiler.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include "dawn/SIR/ASTExpr.h"
+#include "dawn/SIR/ASTStmt.h"
+#include "dawn/SIR/SIR.h"
+#include "dawn/Support/Format.h"
+#include "dawn/Support/UIDGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+using namespace dawn;
+
+namespace {
+
+/// Parameters of a synthetic stencil
+struct StencilShape {
+  int NumStages = 100;    ///< Number of vertical regions, each with a single statement
+  int NumFields = 16;     ///< Number of fields, the first half of them is only read
+  int MaxOffset = 2;      ///< Maximum absolute horizontal offset of an input field access
+  int FunctionDepth = 2;  ///< Nesting depth of the stencil functions called by the stages
+  unsigned int Seed = 42; ///< Seed of the random offsets, intervals and field choices
+};
+
+std::shared_ptr<sir::Field> makeField(const std::string& name) {
+  return std::make_shared<sir::Field>(
+      name,
+      sir::FieldDimensions(sir::HorizontalFieldDimension(ast::cartesian, {true, true}), true));
+}
+
+std::shared_ptr<sir::AST> makeAST(std::shared_ptr<sir::Stmt> stmt) {
+  return std::make_shared<sir::AST>(sir::makeBlockStmt(std::vector<std::shared_ptr<sir::Stmt>>{
+      std::move(stmt)}));
+}
+
+std::shared_ptr<sir::Expr> makeBinary(std::shared_ptr<sir::Expr> lhs, const std::string& op,
+                                      std::shared_ptr<sir::Expr> rhs) {
+  return std::make_shared<sir::BinaryOperator>(lhs, op, rhs);
+}
+
+// Stencil functions `fun_0` to `fun_<depth - 1>`, each one calling the previous one. `fun_0`
+// accesses its argument at a horizontal offset, hence every call grows the extents by one point.
+void addStencilFunctions(SIR& sir, int depth) {
+  for(int d = 0; d < depth; ++d) {
+    auto fun = std::make_shared<sir::StencilFunction>();
+    fun->Name = "fun_" + std::to_string(d);
+    fun->Args.push_back(makeField("arg"));
+
+    std::shared_ptr<sir::Expr> body;
+    if(d == 0) {
+      body = makeBinary(
+          std::make_shared<sir::FieldAccessExpr>("arg", ast::Offsets{ast::cartesian, 1, 0, 0}), "-",
+          std::make_shared<sir::FieldAccessExpr>("arg", ast::Offsets{ast::cartesian, -1, 0, 0}));
+    } else {
+      auto call = std::make_shared<sir::StencilFunCallExpr>("fun_" + std::to_string(d - 1));
+      call->getArguments().push_back(std::make_shared<sir::FieldAccessExpr>("arg"));
+      body = makeBinary(makeBinary(call, "*", std::make_shared<sir::LiteralAccessExpr>(
+                                                  "0.5", BuiltinTypeID::Double)),
+                        "+", std::make_shared<sir::FieldAccessExpr>("arg"));
+    }
+    fun->Asts.push_back(makeAST(sir::makeReturnStmt(body)));
+    sir.StencilFunctions.push_back(fun);
+  }
+}
+
+// Stencil whose stages each write one of the output fields (the second half of the fields) from
+// three inputs read at random offsets, the output written by the previous stage, and every fourth
+// stage a call to the outermost stencil function. Outputs are only read pointwise such that the
+// extents, and hence the halo, do not grow with the number of stages.
+std::shared_ptr<SIR> makeSyntheticStencil(const StencilShape& shape) {
+  UIDGenerator::getInstance()->reset();
+  std::mt19937 rng(shape.Seed);
+  const int numInputs = std::max(shape.NumFields / 2, 1);
+  const int numOutputs = std::max(shape.NumFields - numInputs, 1);
+  auto randomInt = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+  auto input = [&](int idx) { return "in_" + std::to_string(idx); };
+  auto output = [&](int idx) { return "out_" + std::to_string(idx); };
+
+  auto sir = std::make_shared<SIR>(ast::GridType::Cartesian);
+  sir->Filename = "synthetic.cpp";
+  addStencilFunctions(*sir, shape.FunctionDepth);
+
+  auto stencil = std::make_shared<sir::Stencil>();
+  stencil->Name = "synthetic_" + std::to_string(shape.NumStages);
+  for(int i = 0; i < numInputs; ++i)
+    stencil->Fields.push_back(makeField(input(i)));
+  for(int i = 0; i < numOutputs; ++i)
+    stencil->Fields.push_back(makeField(output(i)));
+
+  const std::vector<sir::Interval> intervals{
+      sir::Interval(sir::Interval::Start, sir::Interval::End),
+      sir::Interval(sir::Interval::Start, sir::Interval::Start),
+      sir::Interval(sir::Interval::Start, sir::Interval::End, 1, -1),
+      sir::Interval(sir::Interval::End, sir::Interval::End)};
+
+  auto stencilDescAst = sir::makeBlockStmt();
+  for(int s = 0; s < shape.NumStages; ++s) {
+    auto readInput = [&]() -> std::shared_ptr<sir::Expr> {
+      return std::make_shared<sir::FieldAccessExpr>(
+          input(randomInt(0, numInputs - 1)),
+          ast::Offsets{ast::cartesian, randomInt(-shape.MaxOffset, shape.MaxOffset),
+                       randomInt(-shape.MaxOffset, shape.MaxOffset), randomInt(-1, 1)});
+    };
+
+    std::shared_ptr<sir::Expr> rhs = makeBinary(readInput(), "*", readInput());
+    rhs = makeBinary(rhs, "+", readInput());
+    if(s > 0)
+      rhs = makeBinary(rhs, "+",
+                       std::make_shared<sir::FieldAccessExpr>(output((s - 1) % numOutputs)));
+    if(shape.FunctionDepth > 0 && s % 4 == 0) {
+      auto call = std::make_shared<sir::StencilFunCallExpr>(
+          "fun_" + std::to_string(shape.FunctionDepth - 1));
+      call->getArguments().push_back(
+          std::make_shared<sir::FieldAccessExpr>(input(randomInt(0, numInputs - 1))));
+      rhs = makeBinary(rhs, "-", call);
+    }
+
+    auto stmt = sir::makeExprStmt(std::make_shared<sir::AssignmentExpr>(
+        std::make_shared<sir::FieldAccessExpr>(output(s % numOutputs)), rhs));
+    auto verticalRegion = std::make_shared<sir::VerticalRegion>(
+        makeAST(stmt),
+        std::make_shared<sir::Interval>(intervals[randomInt(0, intervals.size() - 1)]),
+        sir::VerticalRegion::LoopOrderKind::Forward);
+    stencilDescAst->push_back(sir::makeVerticalRegionDeclStmt(verticalRegion));
+  }
+  stencil->StencilDescAst = std::make_shared<sir::AST>(stencilDescAst);
+  sir->Stencils.push_back(stencil);
+  return sir;
+}
+
+/// Time of each compilation phase, in milliseconds
+struct PhaseTimes {
+  double Lower = 0, Optimize = 0, Generate = 0;
+  double total() const { return Lower + Optimize + Generate; }
+};
+
+double elapsedMilliseconds(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+/// Peak resident set size of the process so far, in MiB
+double getPeakMemory() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;
+}
+
+/// Lower, optimize and generate code for the synthetic stencil, return false on failure
+bool compile(const StencilShape& shape, const std::string& backend, PhaseTimes& times) {
+  auto sir = makeSyntheticStencil(shape);
+  Options options;
+  options.Backend = backend;
+  DawnCompiler compiler(options);
+
+  auto start = std::chrono::steady_clock::now();
+  auto stencilInstantiationMap = compiler.lowerToIIR(sir);
+  times.Lower = elapsedMilliseconds(start);
+  if(compiler.getDiagnostics().hasErrors())
+    return false;
+
+  start = std::chrono::steady_clock::now();
+  auto optimizedMap =
+      compiler.optimize(stencilInstantiationMap, DawnCompiler::defaultPassGroups(options));
+  times.Optimize = elapsedMilliseconds(start);
+  if(compiler.getDiagnostics().hasErrors())
+    return false;
+
+  start = std::chrono::steady_clock::now();
+  auto translationUnit = compiler.generate(optimizedMap);
+  times.Generate = elapsedMilliseconds(start);
+  return translationUnit && !compiler.getDiagnostics().hasErrors();
+}
+
+void printUsage() {
+  std::cerr << "Usage: DawnBenchmarkCompiler [-backends=b1,b2,...] [-fields=N] [-offset=N] "
+               "[-depth=N] [-seed=N] [-repetitions=N] [-max-scaling=E] [number of stages ...]\n";
+}
+
+} // namespace
+
+/// Time lowering, optimization and code generation of synthetic stencils with a growing number of
+/// stages. For each backend, the scaling column is the exponent `e` of `time ~ stages^e` between
+/// two consecutive sizes. The peak memory is the high-water mark of the process, hence sizes are
+/// benchmarked in increasing order.
+///
+/// With `-max-scaling=E` the benchmark fails if any scaling exceeds `E`, which catches regressions
+/// of the complexity of the compiler independently of the speed of the machine.
+int main(int argc, char* argv[]) {
+  StencilShape shape;
+  std::vector<std::string> backends{"c++-naive", "c++-opt", "gridtools", "cuda"};
+  std::vector<int> sizes;
+  int repetitions = 3;
+  double maxScaling = 0;
+
+  for(int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    auto value = [&](const std::string& flag) -> const char* {
+      return arg.compare(0, flag.size() + 1, flag + "=") == 0 ? argv[i] + flag.size() + 1 : nullptr;
+    };
+    if(const char* v = value("-backends")) {
+      backends.clear();
+      std::istringstream ss(v);
+      for(std::string backend; std::getline(ss, backend, ',');)
+        backends.push_back(backend);
+    } else if(const char* v = value("-fields"))
+      shape.NumFields = std::atoi(v);
+    else if(const char* v = value("-offset"))
+      shape.MaxOffset = std::atoi(v);
+    else if(const char* v = value("-depth"))
+      shape.FunctionDepth = std::atoi(v);
+    else if(const char* v = value("-seed"))
+      shape.Seed = std::atoi(v);
+    else if(const char* v = value("-repetitions"))
+      repetitions = std::max(std::atoi(v), 1);
+    else if(const char* v = value("-max-scaling"))
+      maxScaling = std::atof(v);
+    else if(std::atoi(arg.c_str()) > 0)
+      sizes.push_back(std::atoi(arg.c_str()));
+    else {
+      printUsage();
+      return 1;
+    }
+  }
+  if(sizes.empty())
+    sizes = {25, 50, 100, 200, 400};
+  std::sort(sizes.begin(), sizes.end());
+
+  std::cout << format("%8s %8s %-14s %12s %12s %12s %12s %8s %10s\n", "stages", "fields",
+                      "backend", "lower [ms]", "opt [ms]", "gen [ms]", "total [ms]", "scaling",
+                      "peak [MiB]");
+
+  std::map<std::string, std::pair<int, double>> previous;
+  bool failed = false;
+  for(int numStages : sizes) {
+    shape.NumStages = numStages;
+    for(const auto& backend : backends) {
+      PhaseTimes best;
+      bool success = true;
+      for(int rep = 0; rep < repetitions && success; ++rep) {
+        PhaseTimes times;
+        success = compile(shape, backend, times);
+        if(rep == 0 || times.total() < best.total())
+          best = times;
+      }
+      if(!success) {
+        std::cout << format("%8i %8i %-14s %12s\n", numStages, shape.NumFields, backend, "failed");
+        failed = true;
+        continue;
+      }
+
+      std::string scaling = "-";
+      if(previous.count(backend)) {
+        const auto& [prevStages, prevTime] = previous[backend];
+        const double exponent = std::log(best.total() / prevTime) /
+                                std::log(static_cast<double>(numStages) / prevStages);
+        scaling = format("%.2f", exponent);
+        if(maxScaling > 0 && exponent > maxScaling) {
+          scaling += "!";
+          failed = true;
+        }
+      }
+      previous[backend] = {numStages, best.total()};
+
+      std::cout << format("%8i %8i %-14s %12.3f %12.3f %12.3f %12.3f %8s %10.1f\n", numStages,
+                          shape.NumFields, backend, best.Lower, best.Optimize, best.Generate,
+                          best.total(), scaling, getPeakMemory());
+    }
+  }
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,90 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/Compiler/DawnCompiler.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include "dawn/Support/Format.h"
+#include "dawn/Support/UIDGenerator.h"
+#include "dawn/Unittest/IIRBuilder.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace dawn;
+using namespace dawn::iir;
+
+namespace {
+
+// Stencil with one stage per statement in a single multi-stage. Statement `s` writes field `s`
+// from field `s - 1` and field `s / 2`, hence the stage reordering and merging probe the
+// dependency graphs of multi-stages with up to `numStatements` statements.
+std::shared_ptr<StencilInstantiation> makeChainStencil(int numStatements) {
+  UIDGenerator::getInstance()->reset();
+  CartesianIIRBuilder b;
+  auto in = b.field("in", FieldType::ijk);
+  std::vector<decltype(in)> fields;
+  for(int s = 0; s < numStatements; ++s)
+    fields.push_back(b.field("f" + std::to_string(s), FieldType::ijk));
+
+  auto multiStage = b.multistage(LoopOrderKind::Parallel);
+  for(int s = 0; s < numStatements; ++s) {
+    auto rhs = s == 0 ? b.at(in)
+                      : b.binaryExpr(b.at(fields[s - 1]),
+                                     b.binaryExpr(b.at(fields[s / 2]), b.at(in, {s % 3 - 1, 0, 0}),
+                                                  Op::multiply));
+    multiStage->insertChild(b.stage(b.doMethod(sir::Interval::Start, sir::Interval::End,
+                                               b.stmt(b.assignExpr(b.at(fields[s]),
+                                                                   std::move(rhs))))));
+  }
+  return b.build("chain" + std::to_string(numStatements), b.stencil(std::move(multiStage)));
+}
+
+} // namespace
+
+/// Time the stage reordering and merging on stencils with a growing number of statements
+///
+/// Usage: DawnBenchmarkOptimizer [number of statements ...]
+int main(int argc, char* argv[]) {
+  std::vector<int> sizes;
+  for(int i = 1; i < argc; ++i)
+    sizes.push_back(std::atoi(argv[i]));
+  if(sizes.empty())
+    sizes = {50, 100, 200, 400, 800};
+
+  const int repetitions = 3;
+  std::cout << format("%10s %12s\n", "statements", "time [ms]");
+  for(int numStatements : sizes) {
+    double minTime = -1;
+    for(int rep = 0; rep < repetitions; ++rep) {
+      auto instantiation = makeChainStencil(numStatements);
+      DawnCompiler compiler;
+      const auto start = std::chrono::steady_clock::now();
+      compiler.optimize({{instantiation->getName(), instantiation}},
+                        {PassGroup::StageReordering, PassGroup::StageMerger});
+      const double time =
+          std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+              .count();
+      if(compiler.getDiagnostics().hasErrors()) {
+        std::cerr << "optimization of " << numStatements << " statements failed\n";
+        return 1;
+      }
+      minTime = minTime < 0 ? time : std::min(minTime, time);
+    }
+    std::cout << format("%10i %12.3f\n", numStatements, minTime);
+  }
+  return 0;
+}
@@ -0,0 +1,78 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/CodeGen/TranslationUnit.h"
+#include "dawn/Compiler/DawnCompiler.h"
+#include "dawn/Compiler/Options.h"
+#include "dawn/SIR/SIR.h"
+#include "dawn/Serialization/SIRSerializer.h"
+#include "dawn/Support/UIDGenerator.h"
+#include "test/unit-test/dawn/Optimizer/TestEnvironment.h"
+#include <fstream>
+#include <gtest/gtest.h>
+#include <streambuf>
+#include <string>
+
+using namespace dawn;
+
+namespace {
+
+// Compiles the stencils of several inputs as one SIR, optimizing them on `numThreads` threads
+std::map<std::string, std::string> compileStencils(int numThreads) {
+  UIDGenerator::getInstance()->reset();
+
+  std::shared_ptr<SIR> sir;
+  int stencilIdx = 0;
+  for(const std::string sirFilename :
+      {"input/test_compute_ordered_do_methods.sir",
+       "input/test_compute_read_access_interval_04.sir", "input/test_field_access_interval_03.sir",
+       "input/test_field_access_interval_05.sir"}) {
+    std::string filename = TestEnvironment::path_ + "/" + sirFilename;
+    std::ifstream file(filename);
+    DAWN_ASSERT_MSG((file.good()), std::string("File " + filename + " does not exists").c_str());
+
+    std::string jsonstr((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    auto inputSIR = SIRSerializer::deserializeFromString(jsonstr, SIRSerializer::Format::Json);
+    for(auto& stencil : inputSIR->Stencils)
+      stencil->Name += "_" + std::to_string(stencilIdx++);
+
+    if(!sir)
+      sir = inputSIR;
+    else {
+      sir->Stencils.insert(sir->Stencils.end(), inputSIR->Stencils.begin(),
+                           inputSIR->Stencils.end());
+      sir->StencilFunctions.insert(sir->StencilFunctions.end(), inputSIR->StencilFunctions.begin(),
+                                   inputSIR->StencilFunctions.end());
+    }
+  }
+
+  Options options;
+  options.Backend = "c++-naive";
+  options.OptimizerThreads = numThreads;
+  DawnCompiler compiler(options);
+  auto translationUnit = compiler.compile(sir);
+
+  EXPECT_FALSE(compiler.getDiagnostics().hasErrors());
+  return translationUnit ? translationUnit->getStencils() : std::map<std::string, std::string>{};
+}
+
+TEST(ParallelOptimization, DeterministicCode) {
+  // The parallel optimizer generates exactly the code of the sequential one
+  auto sequentialCode = compileStencils(1);
+  ASSERT_EQ(sequentialCode.size(), 4);
+  for(int numThreads : {2, 3, 4})
+    EXPECT_EQ(compileStencils(numThreads), sequentialCode) << "with " << numThreads << " threads";
+}
+
+} // namespace
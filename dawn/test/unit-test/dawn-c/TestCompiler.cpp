@@ -13,12 +13,21 @@
 //===------------------------------------------------------------------------------------------===//
 
 #include "dawn-c/Compiler.h"
+#include "dawn-c/Options.h"
 #include "dawn-c/TranslationUnit.h"
+#include "dawn/Compiler/CompilationCache.h"
+#include "dawn/SIR/ASTExpr.h"
+#include "dawn/SIR/ASTStmt.h"
+#include "dawn/SIR/SIR.h"
+#include "dawn/Serialization/SIRSerializer.h"
+#include "dawn/Support/FileSystem.h"
+#include "dawn/Support/Json.h"
 #include "dawn/Unittest/CompilerUtil.h"
 #include "dawn/Unittest/IIRBuilder.h"
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cstring>
 #include <fstream>
 
@@ -41,4 +50,142 @@ TEST(CompilerTest, CompileCopyStencil) {
   dawn::CompilerUtil::dumpNaive(of, stencil_instantiation);
 }
 
+// Byte-serialized SIR of the stencil `out_field = in_field`
+std::string makeCopyStencilSIR() {
+  auto sir = std::make_shared<dawn::SIR>(dawn::ast::GridType::Cartesian);
+  auto stencil = std::make_shared<dawn::sir::Stencil>();
+  stencil->Name = "copy";
+  for(const char* name : {"in_field", "out_field"})
+    stencil->Fields.push_back(std::make_shared<dawn::sir::Field>(
+        name, dawn::sir::FieldDimensions(
+                  dawn::sir::HorizontalFieldDimension(dawn::ast::cartesian, {true, true}), true)));
+
+  auto copy = dawn::sir::makeExprStmt(std::make_shared<dawn::sir::AssignmentExpr>(
+      std::make_shared<dawn::sir::FieldAccessExpr>("out_field"),
+      std::make_shared<dawn::sir::FieldAccessExpr>("in_field")));
+  auto verticalRegion = std::make_shared<dawn::sir::VerticalRegion>(
+      std::make_shared<dawn::sir::AST>(dawn::sir::makeBlockStmt(
+          std::vector<std::shared_ptr<dawn::sir::Stmt>>{copy})),
+      std::make_shared<dawn::sir::Interval>(dawn::sir::Interval::Start, dawn::sir::Interval::End),
+      dawn::sir::VerticalRegion::LoopOrderKind::Forward);
+  stencil->StencilDescAst = std::make_shared<dawn::sir::AST>(
+      dawn::sir::makeBlockStmt(std::vector<std::shared_ptr<dawn::sir::Stmt>>{
+          dawn::sir::makeVerticalRegionDeclStmt(verticalRegion)}));
+  sir->Stencils.push_back(stencil);
+  return dawn::SIRSerializer::serializeToString(sir.get(), dawn::SIRSerializer::Format::Byte);
+}
+
+std::vector<fs::path> getCacheEntries(const fs::path& directory) {
+  std::vector<fs::path> entries;
+  for(const auto& entry : fs::directory_iterator(directory))
+    entries.push_back(entry.path());
+  return entries;
+}
+
+TEST(CompilerTest, CompileWithCache) {
+  const fs::path cacheDir = fs::temp_directory_path() / "dawn_test_compile_with_cache";
+  fs::remove_all(cacheDir);
+
+  dawnOptions_t* options = dawnOptionsCreate();
+  dawnOptionsEntry_t* entry = dawnOptionsEntryCreateString(cacheDir.c_str());
+  dawnOptionsSet(options, "CacheDir", entry);
+  dawnOptionsEntryDestroy(entry);
+  entry = dawnOptionsEntryCreateString("c++-naive");
+  dawnOptionsSet(options, "Backend", entry);
+  dawnOptionsEntryDestroy(entry);
+
+  const std::string sir = makeCopyStencilSIR();
+  dawnTranslationUnit_t* translationUnit = dawnCompile(sir.c_str(), sir.size(), options);
+  ASSERT_NE(translationUnit, nullptr);
+  dawnTranslationUnitDestroy(translationUnit);
+  auto entries = getCacheEntries(cacheDir);
+  ASSERT_EQ(entries.size(), 1);
+
+  // Tamper with the entry to observe that the second compilation is served from the cache
+  dawn::json::json cached;
+  std::ifstream(entries[0]) >> cached;
+  cached["globals"] = "// cached";
+  std::ofstream(entries[0]) << cached.dump();
+
+  translationUnit = dawnCompile(sir.c_str(), sir.size(), options);
+  ASSERT_NE(translationUnit, nullptr);
+  char* globals = dawnTranslationUnitGetGlobals(translationUnit);
+  EXPECT_STREQ(globals, "// cached");
+  std::free(globals);
+  dawnTranslationUnitDestroy(translationUnit);
+
+  // An entry of a colliding key is a miss, the compilation overwrites it
+  cached["input"] = "another input";
+  std::ofstream(entries[0]) << cached.dump();
+  translationUnit = dawnCompile(sir.c_str(), sir.size(), options);
+  ASSERT_NE(translationUnit, nullptr);
+  globals = dawnTranslationUnitGetGlobals(translationUnit);
+  EXPECT_STRNE(globals, "// cached");
+  std::free(globals);
+  dawnTranslationUnitDestroy(translationUnit);
+  EXPECT_EQ(getCacheEntries(cacheDir).size(), 1);
+
+  // Different options are a different entry
+  entry = dawnOptionsEntryCreateString("c++-opt");
+  dawnOptionsSet(options, "Backend", entry);
+  dawnOptionsEntryDestroy(entry);
+  translationUnit = dawnCompile(sir.c_str(), sir.size(), options);
+  ASSERT_NE(translationUnit, nullptr);
+  dawnTranslationUnitDestroy(translationUnit);
+  EXPECT_EQ(getCacheEntries(cacheDir).size(), 2);
+
+  dawnOptionsDestroy(options);
+  fs::remove_all(cacheDir);
+}
+
+TEST(CompilerTest, SideEffectsAreNotCached) {
+  dawn::Options options;
+  EXPECT_TRUE(dawn::CompilationCache::isCacheable(options));
+  options.ReportAccesses = true;
+  EXPECT_FALSE(dawn::CompilationCache::isCacheable(options));
+  options = dawn::Options();
+  options.DumpStencilGraph = true;
+  EXPECT_FALSE(dawn::CompilationCache::isCacheable(options));
+  options = dawn::Options();
+  options.ReportPassSetBlockSize = true;
+  EXPECT_FALSE(dawn::CompilationCache::isCacheable(options));
+  options = dawn::Options();
+  options.KeepVarnames = true;
+  EXPECT_TRUE(dawn::CompilationCache::isCacheable(options));
+}
+
+TEST(CompilerTest, CacheEvictsLeastRecentlyUsed) {
+  const fs::path cacheDir = fs::temp_directory_path() / "dawn_test_cache_eviction";
+  fs::remove_all(cacheDir);
+
+  auto makeTranslationUnit = [](const std::string& code) {
+    return dawn::codegen::TranslationUnit("file.cpp", {}, {{"stencil", code}}, "");
+  };
+  auto setLastUse = [&](const std::string& key, std::chrono::hours age) {
+    fs::last_write_time(cacheDir / (key + ".tu.json"),
+                        fs::file_time_type::clock::now() - age);
+  };
+
+  // Every entry has the same size, measure it
+  {
+    dawn::CompilationCache cache(cacheDir.string(), 1 << 20);
+    cache.insert("a", "input", makeTranslationUnit("code"));
+  }
+  const auto entrySize = fs::file_size(cacheDir / "a.tu.json");
+
+  dawn::CompilationCache cache(cacheDir.string(), 2 * entrySize);
+  cache.insert("b", "input", makeTranslationUnit("code"));
+  setLastUse("a", std::chrono::hours(2));
+  setLastUse("b", std::chrono::hours(1));
+
+  // Using `a` makes `b` the least recently used entry
+  ASSERT_NE(cache.lookup("a", "input"), nullptr);
+  cache.insert("c", "input", makeTranslationUnit("code"));
+  EXPECT_NE(cache.lookup("a", "input"), nullptr);
+  EXPECT_EQ(cache.lookup("b", "input"), nullptr);
+  EXPECT_NE(cache.lookup("c", "input"), nullptr);
+
+  fs::remove_all(cacheDir);
+}
+
 } // anonymous namespace
@@ -0,0 +1,93 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "../TestCodeGen.h"
+#include "dawn/Compiler/DawnCompiler.h"
+#include "dawn/Optimizer/PassSetCaches.h"
+
+namespace dawn {
+namespace iir {
+
+class TestCodeGenCXXOpt : public TestCodeGen {
+protected:
+  std::shared_ptr<StencilInstantiation> getKCacheStencil() {
+    UIDGenerator::getInstance()->reset();
+
+    CartesianIIRBuilder b;
+    auto in = b.field("in", FieldType::ijk);
+    auto out = b.field("out", FieldType::ijk);
+    auto tmp = b.tmpField("tmp", FieldType::ijk);
+
+    auto stencil_inst =
+        b.build("generated",
+                b.stencil(b.multistage(
+                    LoopOrderKind::Forward,
+                    b.stage(b.doMethod(SInterval::Start, SInterval::End,
+                                       b.stmt(b.assignExpr(b.at(tmp), b.at(in))))),
+                    b.stage(b.doMethod(SInterval::Start, SInterval::End, 1, 0,
+                                       b.stmt(b.assignExpr(b.at(out), b.at(tmp, {0, 0, -1}))))))));
+
+    // tmp is written before it is read in all levels, hence gets a local k-cache
+    DawnCompiler compiler;
+    OptimizerContext::OptimizerContextOptions optimizerOptions;
+    OptimizerContext optimizer(compiler.getDiagnostics(), optimizerOptions,
+                               std::make_shared<dawn::SIR>(ast::GridType::Cartesian));
+    PassSetCaches cachingPass(optimizer);
+    cachingPass.run(stencil_inst);
+
+    return stencil_inst;
+  }
+
+  std::shared_ptr<StencilInstantiation> getTileTemporaryStencil() {
+    UIDGenerator::getInstance()->reset();
+
+    CartesianIIRBuilder b;
+    auto in = b.field("in", FieldType::ijk);
+    auto out = b.field("out", FieldType::ijk);
+    auto tmp = b.tmpField("tmp", FieldType::ijk);
+
+    // tmp is only accessed in the multistage, hence lives in a buffer of the tile
+    auto stencil_inst = b.build(
+        "generated",
+        b.stencil(b.multistage(
+            LoopOrderKind::Parallel,
+            b.stage(b.doMethod(SInterval::Start, SInterval::End,
+                               b.stmt(b.assignExpr(b.at(tmp), b.at(in))))),
+            b.stage(b.doMethod(
+                SInterval::Start, SInterval::End,
+                b.stmt(b.assignExpr(b.at(out), b.binaryExpr(b.at(tmp, {-1, 0, 0}),
+                                                            b.at(tmp, {1, 0, 0})))))))));
+
+    return stencil_inst;
+  }
+};
+
+TEST_F(TestCodeGenCXXOpt, GlobalIndexStencil) {
+  runTest(this->getGlobalIndexStencil(), "global_indexing_opt.cpp");
+}
+
+TEST_F(TestCodeGenCXXOpt, LaplacianStencil) {
+  runTest(this->getLaplacianStencil(), "laplacian_stencil_opt.cpp");
+}
+
+TEST_F(TestCodeGenCXXOpt, KCacheStencil) {
+  runTest(this->getKCacheStencil(), "kcache_stencil_opt.cpp");
+}
+
+TEST_F(TestCodeGenCXXOpt, TileTemporaryStencil) {
+  runTest(this->getTileTemporaryStencil(), "tile_temporary_stencil_opt.cpp");
+}
+
+} // namespace iir
+} // namespace dawn
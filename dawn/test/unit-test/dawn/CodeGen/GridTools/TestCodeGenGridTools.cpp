@@ -0,0 +1,29 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "../TestCodeGen.h"
+
+namespace dawn {
+namespace iir {
+
+class TestCodeGenGridTools : public TestCodeGen {};
+
+TEST_F(TestCodeGenGridTools, SharedTemporaryStorage) {
+  // tmp_a is dead once out_a is computed, hence the stencils writing and reading tmp_b are run on
+  // the storage of tmp_a
+  runTest(this->getStencilFromIIR("shared_temporary_storage"), "shared_temporary_storage_gt.cpp");
+}
+
+} // namespace iir
+} // namespace dawn
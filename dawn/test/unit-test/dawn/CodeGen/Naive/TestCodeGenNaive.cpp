@@ -13,6 +13,7 @@
 //===------------------------------------------------------------------------------------------===//
 
 #include "../TestCodeGen.h"
+#include "dawn/IIR/IIRNodeIterator.h"
 
 namespace dawn {
 namespace iir {
@@ -39,5 +40,41 @@ TEST_F(TestCodeGenNaive, DzCStencil) {
   runTest(this->getStencilFromIIR("update_dz_c"), "update_dz_c.cpp");
 }
 
+TEST_F(TestCodeGenNaive, SharedTemporaryStorage) {
+  runTest(this->getStencilFromIIR("shared_temporary_storage"), "shared_temporary_storage.cpp");
+}
+
+TEST_F(TestCodeGenNaive, LoopOrder) {
+  // The laplacian is a parallel multistage, so the vertical loop may be innermost
+  std::ostringstream oss;
+  CompilerUtil::dumpNaive(oss, this->getLaplacianStencil(), "ijk");
+  const std::string code = oss.str();
+  const auto iLoop = code.find("for(int i = "), jLoop = code.find("for(int j = "),
+             kLoop = code.find("for(int k = ");
+  ASSERT_NE(kLoop, std::string::npos);
+  EXPECT_LT(iLoop, jLoop);
+  EXPECT_LT(jLoop, kLoop);
+}
+
+TEST_F(TestCodeGenNaive, Timers) {
+  auto stencil = this->getLaplacianStencil();
+  std::ostringstream oss;
+  CompilerUtil::dumpNaive(oss, stencil, "kji", true);
+  const std::string code = oss.str();
+  EXPECT_NE(code.find("#include <driver-includes/timer_x86.hpp>"), std::string::npos);
+  EXPECT_NE(code.find(": public gridtools::dawn::timer_x86"), std::string::npos);
+  EXPECT_NE(code.find("get_stage_times"), std::string::npos);
+  EXPECT_NE(code.find("reset_meters"), std::string::npos);
+
+  // Every stage loop nest is timed
+  for(const auto& stage : iterateIIROver<Stage>(*stencil->getIIR())) {
+    const std::string timer = "m_stage" + std::to_string(stage->getStageID()) + "_timer";
+    const auto start = code.find(timer + ".start()"), pause = code.find(timer + ".pause()");
+    ASSERT_NE(start, std::string::npos);
+    EXPECT_LT(start, code.find("for(int i = ", start));
+    EXPECT_LT(code.find("for(int i = ", start), pause);
+  }
+}
+
 } // namespace iir
 } // namespace dawn
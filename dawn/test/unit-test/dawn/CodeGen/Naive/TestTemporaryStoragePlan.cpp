@@ -0,0 +1,42 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "../TestCodeGen.h"
+#include "dawn/CodeGen/TemporaryStoragePlan.h"
+
+namespace dawn {
+namespace iir {
+
+TEST(TestTemporaryStoragePlan, DisjointRangesShareStorages) {
+  // [0,1] and [2,3] are disjoint, [1,2] overlaps both
+  EXPECT_EQ(codegen::assignStorages({{0, 1}, {2, 3}, {1, 2}}), (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(codegen::assignStorages({{0, 1}, {2, 3}, {4, 4}}), (std::vector<int>{0, 0, 0}));
+  EXPECT_EQ(codegen::assignStorages({{2, 2}, {0, 3}, {0, 0}, {1, 1}}),
+            (std::vector<int>{1, 0, 1, 1}));
+}
+
+TEST(TestTemporaryStoragePlan, OverlappingRanges) {
+  // ranges sharing a statement are live at the same time
+  EXPECT_EQ(codegen::assignStorages({{0, 2}, {2, 4}, {1, 3}}), (std::vector<int>{0, 2, 1}));
+  EXPECT_TRUE(codegen::assignStorages({}).empty());
+}
+
+class TestTemporaryStoragePlanStencil : public TestCodeGen {};
+
+TEST_F(TestTemporaryStoragePlanStencil, NoInterStencilTemporaries) {
+  EXPECT_TRUE(codegen::planInterStencilTemporaryStorages(*getLaplacianStencil()).empty());
+}
+
+} // namespace iir
+} // namespace dawn
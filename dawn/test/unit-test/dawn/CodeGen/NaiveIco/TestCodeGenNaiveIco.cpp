@@ -0,0 +1,91 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "../TestCodeGen.h"
+
+namespace dawn {
+namespace iir {
+
+using LocType = ast::LocationType;
+
+class TestCodeGenNaiveIco : public TestCodeGen {
+protected:
+  std::shared_ptr<StencilInstantiation> getReductionStencil() {
+    UIDGenerator::getInstance()->reset();
+
+    UnstructuredIIRBuilder b;
+    auto cell_f = b.field("cell_field", LocType::Cells);
+    auto edge_f = b.field("edge_field", LocType::Edges);
+    auto out_f = b.field("out_field", LocType::Cells);
+
+    // the stage over edges reduces twice over the same neighbors
+    auto stencil_inst = b.build(
+        "reductions",
+        b.stencil(b.multistage(
+            LoopOrderKind::Parallel,
+            b.stage(LocType::Edges,
+                    b.doMethod(SInterval::Start, SInterval::End,
+                               b.stmt(b.assignExpr(
+                                   b.at(edge_f),
+                                   b.binaryExpr(
+                                       b.reduceOverNeighborExpr<float>(
+                                           Op::plus, b.at(cell_f, HOffsetType::withOffset, 0),
+                                           b.lit(0.), {LocType::Edges, LocType::Cells},
+                                           std::vector<float>({1., -1.})),
+                                       b.reduceOverNeighborExpr(
+                                           Op::plus, b.at(cell_f, HOffsetType::withOffset, 0),
+                                           b.lit(0.), {LocType::Edges, LocType::Cells}),
+                                       Op::multiply))))),
+            b.stage(LocType::Cells,
+                    b.doMethod(SInterval::Start, SInterval::End,
+                               b.stmt(b.assignExpr(
+                                   b.at(out_f),
+                                   b.reduceOverNeighborExpr(
+                                       Op::plus, b.at(edge_f, HOffsetType::withOffset, 0),
+                                       b.lit(0.), {LocType::Cells, LocType::Edges}))))))));
+
+    return stencil_inst;
+  }
+
+  void runTest(const std::shared_ptr<StencilInstantiation> stencil_inst,
+               const std::string& ref_file, bool staticNbhChains = false, bool kInnerLoops = false,
+               bool openMPLoops = false) {
+    std::ostringstream oss;
+    CompilerUtil::dumpNaiveIco(oss, stencil_inst, staticNbhChains, kInnerLoops, openMPLoops);
+
+    std::string ref = readFile("../reference/" + ref_file);
+    ASSERT_EQ(oss.str(), ref) << "Generated code does not match reference code";
+  }
+};
+
+TEST_F(TestCodeGenNaiveIco, Reductions) { runTest(getReductionStencil(), "reductions_ico.cpp"); }
+
+TEST_F(TestCodeGenNaiveIco, StaticNbhChains) {
+  // the chains are template arguments of the reductions and the weights are std::arrays
+  runTest(getReductionStencil(), "reductions_ico_static_chains.cpp", true);
+}
+
+TEST_F(TestCodeGenNaiveIco, KInnerLoops) {
+  // the neighbors are looked up once per column and shared by the reductions over the same chain
+  runTest(getReductionStencil(), "reductions_ico_k_inner.cpp", false, true);
+}
+
+TEST_F(TestCodeGenNaiveIco, OpenMPLoops) {
+  // a single parallel region encloses the vertical loop, within which the stages share their
+  // loops over the locations
+  runTest(getReductionStencil(), "reductions_ico_openmp.cpp", false, false, true);
+}
+
+} // namespace iir
+} // namespace dawn
@@ -128,6 +128,10 @@ protected:
     std::ostringstream oss;
     if(ref_file.find(".cu") != std::string::npos) {
       CompilerUtil::dumpCuda(oss, stencil_inst);
+    } else if(ref_file.find("_opt.cpp") != std::string::npos) {
+      CompilerUtil::dumpCXXOpt(oss, stencil_inst);
+    } else if(ref_file.find("_gt.cpp") != std::string::npos) {
+      CompilerUtil::dumpGridTools(oss, stencil_inst);
     } else {
       CompilerUtil::dumpNaive(oss, stencil_inst);
     }
@@ -86,8 +86,8 @@ private:
       gridtools::data_view<storage_ijk_t> out= gridtools::make_host_view(out_);
       std::array<int,3> out_offsets{0,0,0};
     for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 if((m_globals.var1 == (int) 1))
 {
   out(i+0, j+0, k+0) = in(i+1, j+0, k+0);
@@ -55,10 +55,6 @@ private:
       return {col * (dom.isize() - dom.iplus()), row * (dom.jsize() - dom.jplus())};
     }
 
-    static bool checkOffset(unsigned int min, unsigned int max, unsigned int val) {
-      return (min <= val && val < max);
-    }
-
     // Temporary storages
     using tmp_halo_t = gridtools::halo< GRIDTOOLS_DAWN_HALO_EXTENT, GRIDTOOLS_DAWN_HALO_EXTENT, 0>;
     using tmp_meta_data_t = storage_traits_t::storage_info_t< 0, 3, tmp_halo_t >;
@@ -86,18 +82,17 @@ private:
       gridtools::data_view<storage_ijk_t> out_field= gridtools::make_host_view(out_field_);
       std::array<int,3> out_field_offsets{0,0,0};
     for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 {
   out_field(i+0, j+0, k+0) = in_field(i+0, j+0, k+0);
 }
-        }      }      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
-          if(checkOffset(stage14GlobalJIndices[0], stage14GlobalJIndices[1], globalOffsets[1] + j)) {
+        }      }      for(int j = std::max(jMin+0, stage14GlobalJIndices[0] - int(globalOffsets[1])); j  <=  std::min(jMax+0, stage14GlobalJIndices[1] - 1 - int(globalOffsets[1])); ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 {
   out_field(i+0, j+0, k+0) = (int) 10;
 }
-          }        }      }    }}      in_field_.sync();
+        }      }    }}      in_field_.sync();
       out_field_.sync();
     }
   };
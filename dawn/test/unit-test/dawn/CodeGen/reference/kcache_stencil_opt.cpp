@@ -0,0 +1,121 @@
+#define DAWN_GENERATED 1
+#undef DAWN_BACKEND_T
+#define DAWN_BACKEND_T CXXOPT
+#ifndef BOOST_RESULT_OF_USE_TR1
+ #define BOOST_RESULT_OF_USE_TR1 1
+#endif
+#ifndef BOOST_NO_CXX11_DECLTYPE
+ #define BOOST_NO_CXX11_DECLTYPE 1
+#endif
+#ifndef GRIDTOOLS_DAWN_HALO_EXTENT
+ #define GRIDTOOLS_DAWN_HALO_EXTENT 0
+#endif
+#ifndef BOOST_PP_VARIADICS
+ #define BOOST_PP_VARIADICS 1
+#endif
+#ifndef BOOST_FUSION_DONT_USE_PREPROCESSED_FILES
+ #define BOOST_FUSION_DONT_USE_PREPROCESSED_FILES 1
+#endif
+#ifndef BOOST_MPL_CFG_NO_PREPROCESSED_HEADERS
+ #define BOOST_MPL_CFG_NO_PREPROCESSED_HEADERS 1
+#endif
+#ifndef GT_VECTOR_LIMIT_SIZE
+ #define GT_VECTOR_LIMIT_SIZE 30
+#endif
+#ifndef BOOST_FUSION_INVOKE_MAX_ARITY
+ #define BOOST_FUSION_INVOKE_MAX_ARITY GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef FUSION_MAX_VECTOR_SIZE
+ #define FUSION_MAX_VECTOR_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef FUSION_MAX_MAP_SIZE
+ #define FUSION_MAX_MAP_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef BOOST_MPL_LIMIT_VECTOR_SIZE
+ #define BOOST_MPL_LIMIT_VECTOR_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#include <driver-includes/gridtools_includes.hpp>
+using namespace gridtools::dawn;
+namespace dawn_generated{
+namespace cxxopt{
+
+class generated {
+private:
+
+  struct stencil_26 {
+
+    // Members
+
+    // Temporary storages
+    using tmp_halo_t = gridtools::halo< GRIDTOOLS_DAWN_HALO_EXTENT, GRIDTOOLS_DAWN_HALO_EXTENT, 0>;
+    using tmp_meta_data_t = storage_traits_t::storage_info_t< 0, 3, tmp_halo_t >;
+    using tmp_storage_t = storage_traits_t::data_store_t< ::dawn::float_type, tmp_meta_data_t>;
+    const gridtools::dawn::domain m_dom;
+
+    // Input/Output storages
+    tmp_meta_data_t m_tmp_meta_data;
+    tmp_storage_t m___tmp_tmp_3;
+  public:
+
+    stencil_26(const gridtools::dawn::domain& dom_, int rank, int xcols, int ycols) : m_dom(dom_), m_tmp_meta_data(dom_.isize(), dom_.jsize(), dom_.ksize() + 2*0), m___tmp_tmp_3(m_tmp_meta_data){}
+    static constexpr dawn::driver::cartesian_extent in_extent = {0,0, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent out_extent = {0,0, 0,0, 0,0};
+
+    void run(storage_ijk_t& in_, storage_ijk_t& out_) {
+      int iMin = m_dom.iminus();
+      int iMax = m_dom.isize() - m_dom.iplus() - 1;
+      int jMin = m_dom.jminus();
+      int jMax = m_dom.jsize() - m_dom.jplus() - 1;
+      int kMin = m_dom.kminus();
+      int kMax = m_dom.ksize() - m_dom.kplus() - 1;
+      in_.sync();
+      out_.sync();
+{      gridtools::data_view<storage_ijk_t> in= gridtools::make_host_view(in_);
+      std::array<int,3> in_offsets{0,0,0};
+      gridtools::data_view<storage_ijk_t> out= gridtools::make_host_view(out_);
+      std::array<int,3> out_offsets{0,0,0};
+      gridtools::data_view<tmp_storage_t> __tmp_tmp_3= gridtools::make_host_view(m___tmp_tmp_3);
+      std::array<int,3> __tmp_tmp_3_offsets{0,0,0};
+      ::dawn::float_type __tmp_tmp_3_cache[2][128];
+    for(int ib = iMin; ib <= iMax; ib += 32) {
+      for(int jb = jMin; jb <= jMax; jb += 4) {
+          const int ie = ib + 31 < iMax ? ib + 31 : iMax;
+          const int je = jb + 3 < jMax ? jb + 3 : jMax;
+        for(int k = kMin + 0+0; k <= kMin + 0+0; ++k) {
+          for(int j = jb+0; j <= je+0; ++j) {
+#pragma omp simd
+            for(int i = ib+0; i <= ie+0; ++i) {
+__tmp_tmp_3_cache[((k+0)%2+2)%2][(j+0-jb+0)*32+i+0-ib+0] = in(i+0, j+0, k+0);
+            }          }        }        for(int k = kMin + 1+0; k <= kMax + 0+0; ++k) {
+          for(int j = jb+0; j <= je+0; ++j) {
+#pragma omp simd
+            for(int i = ib+0; i <= ie+0; ++i) {
+{
+__tmp_tmp_3_cache[((k+0)%2+2)%2][(j+0-jb+0)*32+i+0-ib+0] = in(i+0, j+0, k+0);
+}
+{
+out(i+0, j+0, k+0) = __tmp_tmp_3_cache[((k+-1)%2+2)%2][(j+0-jb+0)*32+i+0-ib+0];
+}
+            }          }        }      }    }}      in_.sync();
+      out_.sync();
+    }
+  };
+  static constexpr const char* s_name = "generated";
+  stencil_26 m_stencil_26;
+public:
+
+  generated(const generated&) = delete;
+
+  generated(const gridtools::dawn::domain& dom, int rank = 1, int xcols = 1, int ycols = 1) : m_stencil_26(dom, rank, xcols, ycols){
+    assert(dom.isize() >= dom.iminus() + dom.iplus());
+    assert(dom.jsize() >= dom.jminus() + dom.jplus());
+    assert(dom.ksize() >= dom.kminus() + dom.kplus());
+    assert(dom.ksize() >= 1);
+  }
+
+  void run(storage_ijk_t in, storage_ijk_t out) {
+    m_stencil_26.run(in,out);
+  }
+};
+} // namespace cxxopt
+} // namespace dawn_generated
@@ -0,0 +1,82 @@
+#define DAWN_GENERATED 1
+#undef DAWN_BACKEND_T
+#define DAWN_BACKEND_T CXXNAIVEICO
+#include <driver-includes/unstructured_interface.hpp>
+namespace dawn_generated{
+namespace cxxnaiveico{
+template<typename LibTag>
+class reductions {
+private:
+
+  struct stencil_47 {
+    dawn::mesh_t<LibTag> const& m_mesh;
+    int m_k_size;
+    dawn::cell_field_t<LibTag, double>& m_cell_field;
+    dawn::edge_field_t<LibTag, double>& m_edge_field;
+    dawn::cell_field_t<LibTag, double>& m_out_field;
+  public:
+
+    stencil_47(dawn::mesh_t<LibTag> const &mesh, int k_size, dawn::cell_field_t<LibTag, double>&cell_field, dawn::edge_field_t<LibTag, double>&edge_field, dawn::cell_field_t<LibTag, double>&out_field) : m_mesh(mesh), m_k_size(k_size), m_cell_field(cell_field), m_edge_field(edge_field), m_out_field(out_field){}
+
+    ~stencil_47() {
+    }
+
+    void sync_storages() {
+    }
+    static constexpr dawn::driver::unstructured_extent cell_field_extent = {true, 0,0};
+    static constexpr dawn::driver::unstructured_extent edge_field_extent = {true, 0,0};
+    static constexpr dawn::driver::unstructured_extent out_field_extent = {false, 0,0};
+
+    void run() {
+      using dawn::deref;
+{
+#pragma omp parallel
+{
+    for(int k = 0+0; k <= ( m_k_size == 0 ? 0 : (m_k_size - 1)) + 0+0; ++k) {
+{
+        auto&& locs = getEdges(LibTag{}, m_mesh);
+#pragma omp for
+      for(int loc_idx = 0; loc_idx < int(locs.size()); ++loc_idx) {
+          auto const& loc = locs[loc_idx];
+int m_sparse_dimension_idx = 0;
+m_edge_field(deref(LibTag{}, loc),k+0) = (reduce(LibTag{}, m_mesh,loc, (::dawn::float_type) 0.000000, std::vector<dawn::LocationType>{dawn::LocationType::Edges, dawn::LocationType::Cells}, [&](auto& lhs, auto red_loc, auto const& weight) {
+lhs += weight * m_cell_field(deref(LibTag{}, red_loc),k+0);
+m_sparse_dimension_idx++;
+return lhs;
+}, std::vector<::dawn::float_type>({(::dawn::float_type) 1.000000, (::dawn::float_type) -1.000000})) * reduce(LibTag{}, m_mesh,loc, (::dawn::float_type) 0.000000, std::vector<dawn::LocationType>{dawn::LocationType::Edges, dawn::LocationType::Cells}, [&](auto& lhs, auto red_loc) { lhs += m_cell_field(deref(LibTag{}, red_loc),k+0);
+m_sparse_dimension_idx++;
+return lhs;
+}));
+      }}
+{
+        auto&& locs = getCells(LibTag{}, m_mesh);
+#pragma omp for
+      for(int loc_idx = 0; loc_idx < int(locs.size()); ++loc_idx) {
+          auto const& loc = locs[loc_idx];
+int m_sparse_dimension_idx = 0;
+m_out_field(deref(LibTag{}, loc),k+0) = reduce(LibTag{}, m_mesh,loc, (::dawn::float_type) 0.000000, std::vector<dawn::LocationType>{dawn::LocationType::Cells, dawn::LocationType::Edges}, [&](auto& lhs, auto red_loc) { lhs += m_edge_field(deref(LibTag{}, red_loc),k+0);
+m_sparse_dimension_idx++;
+return lhs;
+});
+      }}
+    }}
+}      sync_storages();
+    }
+  };
+  static constexpr const char* s_name = "reductions";
+  stencil_47 m_stencil_47;
+public:
+
+  reductions(const reductions&) = delete;
+
+  // Members
+
+  reductions(const dawn::mesh_t<LibTag> &mesh, int k_size, dawn::cell_field_t<LibTag, double>& cell_field, dawn::edge_field_t<LibTag, double>& edge_field, dawn::cell_field_t<LibTag, double>& out_field) : m_stencil_47(mesh, k_size,cell_field,edge_field,out_field){}
+
+  void run() {
+    m_stencil_47.run();
+;
+  }
+};
+} // namespace cxxnaiveico
+} // namespace dawn_generated
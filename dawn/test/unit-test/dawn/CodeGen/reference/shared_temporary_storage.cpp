@@ -0,0 +1,260 @@
+#define DAWN_GENERATED 1
+#undef DAWN_BACKEND_T
+#define DAWN_BACKEND_T CXXNAIVE
+#ifndef BOOST_RESULT_OF_USE_TR1
+ #define BOOST_RESULT_OF_USE_TR1 1
+#endif
+#ifndef BOOST_NO_CXX11_DECLTYPE
+ #define BOOST_NO_CXX11_DECLTYPE 1
+#endif
+#ifndef GRIDTOOLS_DAWN_HALO_EXTENT
+ #define GRIDTOOLS_DAWN_HALO_EXTENT 0
+#endif
+#ifndef BOOST_PP_VARIADICS
+ #define BOOST_PP_VARIADICS 1
+#endif
+#ifndef BOOST_FUSION_DONT_USE_PREPROCESSED_FILES
+ #define BOOST_FUSION_DONT_USE_PREPROCESSED_FILES 1
+#endif
+#ifndef BOOST_MPL_CFG_NO_PREPROCESSED_HEADERS
+ #define BOOST_MPL_CFG_NO_PREPROCESSED_HEADERS 1
+#endif
+#ifndef GT_VECTOR_LIMIT_SIZE
+ #define GT_VECTOR_LIMIT_SIZE 30
+#endif
+#ifndef BOOST_FUSION_INVOKE_MAX_ARITY
+ #define BOOST_FUSION_INVOKE_MAX_ARITY GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef FUSION_MAX_VECTOR_SIZE
+ #define FUSION_MAX_VECTOR_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef FUSION_MAX_MAP_SIZE
+ #define FUSION_MAX_MAP_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef BOOST_MPL_LIMIT_VECTOR_SIZE
+ #define BOOST_MPL_LIMIT_VECTOR_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#include <driver-includes/gridtools_includes.hpp>
+using namespace gridtools::dawn;
+namespace dawn_generated{
+namespace cxxnaive{
+
+struct globals {
+  double scale;
+
+  globals() {
+  }
+};
+} // namespace cxxnaive
+} // namespace dawn_generated
+namespace dawn_generated{
+namespace cxxnaive{
+
+class generated {
+private:
+
+  struct stencil_51 {
+
+    // Members
+
+    // Temporary storages
+    using tmp_halo_t = gridtools::halo< GRIDTOOLS_DAWN_HALO_EXTENT, GRIDTOOLS_DAWN_HALO_EXTENT, 0>;
+    using tmp_meta_data_t = storage_traits_t::storage_info_t< 0, 3, tmp_halo_t >;
+    using tmp_storage_t = storage_traits_t::data_store_t< ::dawn::float_type, tmp_meta_data_t>;
+    const gridtools::dawn::domain m_dom;
+    const globals& m_globals;
+
+    // Input/Output storages
+  public:
+
+    stencil_51(const gridtools::dawn::domain& dom_, const globals& globals_, int rank, int xcols, int ycols) : m_dom(dom_), m_globals(globals_){}
+    static constexpr dawn::driver::cartesian_extent in_extent = {1,1, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_a_extent = {0,0, 0,0, 0,0};
+
+    void run(storage_ijk_t& in_, storage_ijk_t& tmp_a_) {
+      int iMin = m_dom.iminus();
+      int iMax = m_dom.isize() - m_dom.iplus() - 1;
+      int jMin = m_dom.jminus();
+      int jMax = m_dom.jsize() - m_dom.jplus() - 1;
+      int kMin = m_dom.kminus();
+      int kMax = m_dom.ksize() - m_dom.kplus() - 1;
+      in_.sync();
+      tmp_a_.sync();
+{      gridtools::data_view<storage_ijk_t> in= gridtools::make_host_view(in_);
+      std::array<int,3> in_offsets{0,0,0};
+      gridtools::data_view<storage_ijk_t> tmp_a= gridtools::make_host_view(tmp_a_);
+      std::array<int,3> tmp_a_offsets{0,0,0};
+    for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
+tmp_a(i+0, j+0, k+0) = in(i+1, j+0, k+0);
+        }      }    }}      in_.sync();
+      tmp_a_.sync();
+    }
+  };
+
+  struct stencil_99 {
+
+    // Members
+
+    // Temporary storages
+    using tmp_halo_t = gridtools::halo< GRIDTOOLS_DAWN_HALO_EXTENT, GRIDTOOLS_DAWN_HALO_EXTENT, 0>;
+    using tmp_meta_data_t = storage_traits_t::storage_info_t< 0, 3, tmp_halo_t >;
+    using tmp_storage_t = storage_traits_t::data_store_t< ::dawn::float_type, tmp_meta_data_t>;
+    const gridtools::dawn::domain m_dom;
+    const globals& m_globals;
+
+    // Input/Output storages
+  public:
+
+    stencil_99(const gridtools::dawn::domain& dom_, const globals& globals_, int rank, int xcols, int ycols) : m_dom(dom_), m_globals(globals_){}
+    static constexpr dawn::driver::cartesian_extent out_a_extent = {0,0, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_a_extent = {-1,-1, 0,0, 0,0};
+
+    void run(storage_ijk_t& out_a_, storage_ijk_t& tmp_a_) {
+      int iMin = m_dom.iminus();
+      int iMax = m_dom.isize() - m_dom.iplus() - 1;
+      int jMin = m_dom.jminus();
+      int jMax = m_dom.jsize() - m_dom.jplus() - 1;
+      int kMin = m_dom.kminus();
+      int kMax = m_dom.ksize() - m_dom.kplus() - 1;
+      out_a_.sync();
+      tmp_a_.sync();
+{      gridtools::data_view<storage_ijk_t> out_a= gridtools::make_host_view(out_a_);
+      std::array<int,3> out_a_offsets{0,0,0};
+      gridtools::data_view<storage_ijk_t> tmp_a= gridtools::make_host_view(tmp_a_);
+      std::array<int,3> tmp_a_offsets{0,0,0};
+    for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
+out_a(i+0, j+0, k+0) = tmp_a(i+-1, j+0, k+0);
+        }      }    }}      out_a_.sync();
+      tmp_a_.sync();
+    }
+  };
+
+  struct stencil_105 {
+
+    // Members
+
+    // Temporary storages
+    using tmp_halo_t = gridtools::halo< GRIDTOOLS_DAWN_HALO_EXTENT, GRIDTOOLS_DAWN_HALO_EXTENT, 0>;
+    using tmp_meta_data_t = storage_traits_t::storage_info_t< 0, 3, tmp_halo_t >;
+    using tmp_storage_t = storage_traits_t::data_store_t< ::dawn::float_type, tmp_meta_data_t>;
+    const gridtools::dawn::domain m_dom;
+    const globals& m_globals;
+
+    // Input/Output storages
+  public:
+
+    stencil_105(const gridtools::dawn::domain& dom_, const globals& globals_, int rank, int xcols, int ycols) : m_dom(dom_), m_globals(globals_){}
+    static constexpr dawn::driver::cartesian_extent in_extent = {-1,-1, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_b_extent = {0,0, 0,0, 0,0};
+
+    void run(storage_ijk_t& in_, storage_ijk_t& tmp_b_) {
+      int iMin = m_dom.iminus();
+      int iMax = m_dom.isize() - m_dom.iplus() - 1;
+      int jMin = m_dom.jminus();
+      int jMax = m_dom.jsize() - m_dom.jplus() - 1;
+      int kMin = m_dom.kminus();
+      int kMax = m_dom.ksize() - m_dom.kplus() - 1;
+      in_.sync();
+      tmp_b_.sync();
+{      gridtools::data_view<storage_ijk_t> in= gridtools::make_host_view(in_);
+      std::array<int,3> in_offsets{0,0,0};
+      gridtools::data_view<storage_ijk_t> tmp_b= gridtools::make_host_view(tmp_b_);
+      std::array<int,3> tmp_b_offsets{0,0,0};
+    for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
+tmp_b(i+0, j+0, k+0) = in(i+-1, j+0, k+0);
+        }      }    }}      in_.sync();
+      tmp_b_.sync();
+    }
+  };
+
+  struct stencil_111 {
+
+    // Members
+
+    // Temporary storages
+    using tmp_halo_t = gridtools::halo< GRIDTOOLS_DAWN_HALO_EXTENT, GRIDTOOLS_DAWN_HALO_EXTENT, 0>;
+    using tmp_meta_data_t = storage_traits_t::storage_info_t< 0, 3, tmp_halo_t >;
+    using tmp_storage_t = storage_traits_t::data_store_t< ::dawn::float_type, tmp_meta_data_t>;
+    const gridtools::dawn::domain m_dom;
+    const globals& m_globals;
+
+    // Input/Output storages
+  public:
+
+    stencil_111(const gridtools::dawn::domain& dom_, const globals& globals_, int rank, int xcols, int ycols) : m_dom(dom_), m_globals(globals_){}
+    static constexpr dawn::driver::cartesian_extent out_b_extent = {0,0, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_b_extent = {1,1, 0,0, 0,0};
+
+    void run(storage_ijk_t& out_b_, storage_ijk_t& tmp_b_) {
+      int iMin = m_dom.iminus();
+      int iMax = m_dom.isize() - m_dom.iplus() - 1;
+      int jMin = m_dom.jminus();
+      int jMax = m_dom.jsize() - m_dom.jplus() - 1;
+      int kMin = m_dom.kminus();
+      int kMax = m_dom.ksize() - m_dom.kplus() - 1;
+      out_b_.sync();
+      tmp_b_.sync();
+{      gridtools::data_view<storage_ijk_t> out_b= gridtools::make_host_view(out_b_);
+      std::array<int,3> out_b_offsets{0,0,0};
+      gridtools::data_view<storage_ijk_t> tmp_b= gridtools::make_host_view(tmp_b_);
+      std::array<int,3> tmp_b_offsets{0,0,0};
+    for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
+out_b(i+0, j+0, k+0) = tmp_b(i+1, j+0, k+0);
+        }      }    }}      out_b_.sync();
+      tmp_b_.sync();
+    }
+  };
+  static constexpr const char* s_name = "generated";
+  globals m_globals;
+  stencil_111 m_stencil_111;
+  stencil_99 m_stencil_99;
+  stencil_105 m_stencil_105;
+  stencil_51 m_stencil_51;
+public:
+
+  generated(const generated&) = delete;
+
+  // Members
+  gridtools::dawn::meta_data_t m_meta_data;
+  gridtools::dawn::storage_t m_tmp_a;
+
+  generated(const gridtools::dawn::domain& dom, int rank = 1, int xcols = 1, int ycols = 1) : m_stencil_51(dom, m_globals, rank, xcols, ycols), m_stencil_99(dom, m_globals, rank, xcols, ycols), m_stencil_105(dom, m_globals, rank, xcols, ycols), m_stencil_111(dom, m_globals, rank, xcols, ycols), m_meta_data(dom.isize(), dom.jsize(), dom.ksize() /*+ 2 *0*/ + 1), m_tmp_a (m_meta_data, "tmp_a"){
+    assert(dom.isize() >= dom.iminus() + dom.iplus());
+    assert(dom.jsize() >= dom.jminus() + dom.jplus());
+    assert(dom.ksize() >= dom.kminus() + dom.kplus());
+    assert(dom.ksize() >= 1);
+  }
+
+  // Access-wrapper for globally defined variables
+
+  double get_scale() {
+    return m_globals.scale;
+  }
+
+  void set_scale(double scale) {
+    m_globals.scale=scale;
+  }
+
+  void run(storage_ijk_t in, storage_ijk_t out_a, storage_ijk_t out_b) {
+    m_stencil_51.run(in,m_tmp_a);
+        m_globals.scale = (m_globals.scale * (::dawn::float_type) 2.0);
+;
+    m_stencil_99.run(out_a,m_tmp_a);
+        m_globals.scale = (m_globals.scale * (::dawn::float_type) 2.0);
+;
+    m_stencil_105.run(in,m_tmp_a);
+        m_globals.scale = (m_globals.scale * (::dawn::float_type) 2.0);
+;
+    m_stencil_111.run(out_b,m_tmp_a);
+  }
+};
+} // namespace cxxnaive
+} // namespace dawn_generated
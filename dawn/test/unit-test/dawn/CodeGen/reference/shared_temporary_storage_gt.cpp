@@ -0,0 +1,308 @@
+#define DAWN_GENERATED 1
+#undef DAWN_BACKEND_T
+#define DAWN_BACKEND_T GT
+#ifndef BOOST_RESULT_OF_USE_TR1
+ #define BOOST_RESULT_OF_USE_TR1 1
+#endif
+#ifndef BOOST_NO_CXX11_DECLTYPE
+ #define BOOST_NO_CXX11_DECLTYPE 1
+#endif
+#ifndef GRIDTOOLS_DAWN_HALO_EXTENT
+ #define GRIDTOOLS_DAWN_HALO_EXTENT 0
+#endif
+#ifndef BOOST_PP_VARIADICS
+ #define BOOST_PP_VARIADICS 1
+#endif
+#ifndef BOOST_FUSION_DONT_USE_PREPROCESSED_FILES
+ #define BOOST_FUSION_DONT_USE_PREPROCESSED_FILES 1
+#endif
+#ifndef BOOST_MPL_CFG_NO_PREPROCESSED_HEADERS
+ #define BOOST_MPL_CFG_NO_PREPROCESSED_HEADERS 1
+#endif
+#ifndef GT_VECTOR_LIMIT_SIZE
+ #define GT_VECTOR_LIMIT_SIZE 40
+#endif
+#ifndef BOOST_FUSION_INVOKE_MAX_ARITY
+ #define BOOST_FUSION_INVOKE_MAX_ARITY GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef FUSION_MAX_VECTOR_SIZE
+ #define FUSION_MAX_VECTOR_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef FUSION_MAX_MAP_SIZE
+ #define FUSION_MAX_MAP_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#ifndef BOOST_MPL_LIMIT_VECTOR_SIZE
+ #define BOOST_MPL_LIMIT_VECTOR_SIZE GT_VECTOR_LIMIT_SIZE
+#endif
+#include <driver-includes/gridtools_includes.hpp>
+using namespace gridtools::dawn;
+namespace dawn_generated{
+namespace gt{
+
+struct globals {
+  double scale;
+
+  globals() {
+  }
+};
+} // namespace gt
+} // namespace dawn_generated
+namespace dawn_generated{
+namespace gt{
+
+class generated {
+public:
+  using p_out_b = gridtools::arg<0, storage_ijk_t>;
+  using p_tmp_b = gridtools::arg<1, storage_t>;
+  using p_out_a = gridtools::arg<2, storage_ijk_t>;
+  using p_tmp_a = gridtools::arg<3, storage_t>;
+  using p_in = gridtools::arg<4, storage_ijk_t>;
+  using globals_gp_t = gridtools::global_parameter<backend_t,globals>;
+  using p_globals = gridtools::arg<5, globals_gp_t>;
+
+  struct stencil_51 {
+
+    // Intervals
+    using interval_start__end_ = gridtools::interval<gridtools::level<0, 1, 3>, gridtools::level<1, -1, 3>>;
+    using axis_stencil_51 = gridtools::axis<1, gridtools::axis_config::offset_limit<3>, gridtools::axis_config::extra_offsets<1>>;
+    using grid_stencil_51 = gridtools::grid<axis_stencil_51::axis_interval_t>;
+
+    struct stage_0_0 {
+      using in = gridtools::accessor<0, gridtools::intent::in, gridtools::extent<1, 1, 0, 0, 0, 0>>;
+      using tmp_a = gridtools::accessor<1, gridtools::intent::inout, gridtools::extent<0, 0, 0, 0, 0, 0>>;
+      using param_list = gridtools::make_param_list<in, tmp_a>;
+
+      template<typename Evaluation>
+      GT_FUNCTION static void apply(Evaluation& eval, interval_start__end_) {
+        eval(tmp_a(0,0,0)) = eval(in(1,0,0));
+      }
+    };
+
+    stencil_51(const gridtools::dawn::domain& dom, const globals_gp_t& globals_gp) {
+
+      // Check if extents do not exceed the halos
+      static_assert((static_cast<int>(storage_ijk_t::storage_info_t::halo_t::template at<0>()) >= 1) || (storage_ijk_t::storage_info_t::layout_t::template at<0>() == -1),"Used extents exceed halo limits.");
+
+      // Grid
+      gridtools::halo_descriptor di = {dom.iminus(), dom.iminus(), dom.iplus(), dom.isize() - 1 - dom.iplus(), dom.isize()};
+      gridtools::halo_descriptor dj = {dom.jminus(), dom.jminus(), dom.jplus(), dom.jsize() - 1 - dom.jplus(), dom.jsize()};
+      grid_stencil_51 grid_(make_grid(di, dj, axis_stencil_51{dom.ksize() - dom.kplus() - dom.kminus()}));
+
+      // Computation
+      m_stencil = gridtools::make_computation<backend_t>(grid_, gridtools::make_multistage(gridtools::execute::forward /*parallel*/ (),gridtools::make_stage_with_extent<stage_0_0, gridtools::extent< 0, 0, 0, 0> >(p_in(), p_tmp_a())));
+    }
+
+    // Members
+    gridtools::computation<p_in,p_tmp_a> m_stencil;
+
+    gridtools::computation<p_in,p_tmp_a>* get_stencil() {
+      return &m_stencil;
+    }
+    static constexpr dawn::driver::cartesian_extent in_extent = {1,1, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_a_extent = {0,0, 0,0, 0,0};
+  };
+
+  struct stencil_99 {
+
+    // Intervals
+    using interval_start__end_ = gridtools::interval<gridtools::level<0, 1, 3>, gridtools::level<1, -1, 3>>;
+    using axis_stencil_99 = gridtools::axis<1, gridtools::axis_config::offset_limit<3>, gridtools::axis_config::extra_offsets<1>>;
+    using grid_stencil_99 = gridtools::grid<axis_stencil_99::axis_interval_t>;
+
+    struct stage_0_0 {
+      using out_a = gridtools::accessor<0, gridtools::intent::inout, gridtools::extent<0, 0, 0, 0, 0, 0>>;
+      using tmp_a = gridtools::accessor<1, gridtools::intent::in, gridtools::extent<-1, -1, 0, 0, 0, 0>>;
+      using param_list = gridtools::make_param_list<out_a, tmp_a>;
+
+      template<typename Evaluation>
+      GT_FUNCTION static void apply(Evaluation& eval, interval_start__end_) {
+        eval(out_a(0,0,0)) = eval(tmp_a(-1,0,0));
+      }
+    };
+
+    stencil_99(const gridtools::dawn::domain& dom, const globals_gp_t& globals_gp) {
+
+      // Check if extents do not exceed the halos
+      static_assert(((-1)*static_cast<int>(storage_t::storage_info_t::halo_t::template at<0>()) <= -1) || (storage_t::storage_info_t::layout_t::template at<0>() == -1),"Used extents exceed halo limits.");
+
+      // Grid
+      gridtools::halo_descriptor di = {dom.iminus(), dom.iminus(), dom.iplus(), dom.isize() - 1 - dom.iplus(), dom.isize()};
+      gridtools::halo_descriptor dj = {dom.jminus(), dom.jminus(), dom.jplus(), dom.jsize() - 1 - dom.jplus(), dom.jsize()};
+      grid_stencil_99 grid_(make_grid(di, dj, axis_stencil_99{dom.ksize() - dom.kplus() - dom.kminus()}));
+
+      // Computation
+      m_stencil = gridtools::make_computation<backend_t>(grid_, gridtools::make_multistage(gridtools::execute::forward /*parallel*/ (),gridtools::make_stage_with_extent<stage_0_0, gridtools::extent< 0, 0, 0, 0> >(p_out_a(), p_tmp_a())));
+    }
+
+    // Members
+    gridtools::computation<p_out_a,p_tmp_a> m_stencil;
+
+    gridtools::computation<p_out_a,p_tmp_a>* get_stencil() {
+      return &m_stencil;
+    }
+    static constexpr dawn::driver::cartesian_extent out_a_extent = {0,0, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_a_extent = {-1,-1, 0,0, 0,0};
+  };
+
+  struct stencil_105 {
+
+    // Intervals
+    using interval_start__end_ = gridtools::interval<gridtools::level<0, 1, 3>, gridtools::level<1, -1, 3>>;
+    using axis_stencil_105 = gridtools::axis<1, gridtools::axis_config::offset_limit<3>, gridtools::axis_config::extra_offsets<1>>;
+    using grid_stencil_105 = gridtools::grid<axis_stencil_105::axis_interval_t>;
+
+    struct stage_0_0 {
+      using in = gridtools::accessor<0, gridtools::intent::in, gridtools::extent<-1, -1, 0, 0, 0, 0>>;
+      using tmp_b = gridtools::accessor<1, gridtools::intent::inout, gridtools::extent<0, 0, 0, 0, 0, 0>>;
+      using param_list = gridtools::make_param_list<in, tmp_b>;
+
+      template<typename Evaluation>
+      GT_FUNCTION static void apply(Evaluation& eval, interval_start__end_) {
+        eval(tmp_b(0,0,0)) = eval(in(-1,0,0));
+      }
+    };
+
+    stencil_105(const gridtools::dawn::domain& dom, const globals_gp_t& globals_gp) {
+
+      // Check if extents do not exceed the halos
+      static_assert(((-1)*static_cast<int>(storage_ijk_t::storage_info_t::halo_t::template at<0>()) <= -1) || (storage_ijk_t::storage_info_t::layout_t::template at<0>() == -1),"Used extents exceed halo limits.");
+
+      // Grid
+      gridtools::halo_descriptor di = {dom.iminus(), dom.iminus(), dom.iplus(), dom.isize() - 1 - dom.iplus(), dom.isize()};
+      gridtools::halo_descriptor dj = {dom.jminus(), dom.jminus(), dom.jplus(), dom.jsize() - 1 - dom.jplus(), dom.jsize()};
+      grid_stencil_105 grid_(make_grid(di, dj, axis_stencil_105{dom.ksize() - dom.kplus() - dom.kminus()}));
+
+      // Computation
+      m_stencil = gridtools::make_computation<backend_t>(grid_, gridtools::make_multistage(gridtools::execute::forward /*parallel*/ (),gridtools::make_stage_with_extent<stage_0_0, gridtools::extent< 0, 0, 0, 0> >(p_in(), p_tmp_b())));
+    }
+
+    // Members
+    gridtools::computation<p_in,p_tmp_b> m_stencil;
+
+    gridtools::computation<p_in,p_tmp_b>* get_stencil() {
+      return &m_stencil;
+    }
+    static constexpr dawn::driver::cartesian_extent in_extent = {-1,-1, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_b_extent = {0,0, 0,0, 0,0};
+  };
+
+  struct stencil_111 {
+
+    // Intervals
+    using interval_start__end_ = gridtools::interval<gridtools::level<0, 1, 3>, gridtools::level<1, -1, 3>>;
+    using axis_stencil_111 = gridtools::axis<1, gridtools::axis_config::offset_limit<3>, gridtools::axis_config::extra_offsets<1>>;
+    using grid_stencil_111 = gridtools::grid<axis_stencil_111::axis_interval_t>;
+
+    struct stage_0_0 {
+      using out_b = gridtools::accessor<0, gridtools::intent::inout, gridtools::extent<0, 0, 0, 0, 0, 0>>;
+      using tmp_b = gridtools::accessor<1, gridtools::intent::in, gridtools::extent<1, 1, 0, 0, 0, 0>>;
+      using param_list = gridtools::make_param_list<out_b, tmp_b>;
+
+      template<typename Evaluation>
+      GT_FUNCTION static void apply(Evaluation& eval, interval_start__end_) {
+        eval(out_b(0,0,0)) = eval(tmp_b(1,0,0));
+      }
+    };
+
+    stencil_111(const gridtools::dawn::domain& dom, const globals_gp_t& globals_gp) {
+
+      // Check if extents do not exceed the halos
+      static_assert((static_cast<int>(storage_t::storage_info_t::halo_t::template at<0>()) >= 1) || (storage_t::storage_info_t::layout_t::template at<0>() == -1),"Used extents exceed halo limits.");
+
+      // Grid
+      gridtools::halo_descriptor di = {dom.iminus(), dom.iminus(), dom.iplus(), dom.isize() - 1 - dom.iplus(), dom.isize()};
+      gridtools::halo_descriptor dj = {dom.jminus(), dom.jminus(), dom.jplus(), dom.jsize() - 1 - dom.jplus(), dom.jsize()};
+      grid_stencil_111 grid_(make_grid(di, dj, axis_stencil_111{dom.ksize() - dom.kplus() - dom.kminus()}));
+
+      // Computation
+      m_stencil = gridtools::make_computation<backend_t>(grid_, gridtools::make_multistage(gridtools::execute::forward /*parallel*/ (),gridtools::make_stage_with_extent<stage_0_0, gridtools::extent< 0, 0, 0, 0> >(p_out_b(), p_tmp_b())));
+    }
+
+    // Members
+    gridtools::computation<p_out_b,p_tmp_b> m_stencil;
+
+    gridtools::computation<p_out_b,p_tmp_b>* get_stencil() {
+      return &m_stencil;
+    }
+    static constexpr dawn::driver::cartesian_extent out_b_extent = {0,0, 0,0, 0,0};
+    static constexpr dawn::driver::cartesian_extent tmp_b_extent = {1,1, 0,0, 0,0};
+  };
+
+  // Stencil-Data
+  gridtools::dawn::meta_data_t m_meta_data;
+  gridtools::dawn::storage_t m_tmp_a;
+  const gridtools::dawn::domain m_dom;
+  static constexpr const char* s_name = "generated";
+  globals m_globals;
+  globals_gp_t m_globals_gp;
+
+  void update_globals() {
+    gridtools::update_global_parameter(m_globals_gp, m_globals);
+  }
+
+  // Members representing all the stencils that are called
+  stencil_111 m_stencil_111;
+  stencil_99 m_stencil_99;
+  stencil_105 m_stencil_105;
+  stencil_51 m_stencil_51;
+public:
+
+  generated(const generated&) = delete;
+
+  generated(const gridtools::dawn::domain& dom) : m_meta_data(dom.isize(), dom.jsize(), dom.ksize() /*+ 2 *0*/ + 1), m_tmp_a (m_meta_data, "tmp_a"), m_dom(dom), m_globals_gp(gridtools::make_global_parameter<backend_t>(m_globals)), m_stencil_51(dom, m_globals_gp), m_stencil_99(dom, m_globals_gp), m_stencil_105(dom, m_globals_gp), m_stencil_111(dom, m_globals_gp){}
+
+  template<typename S>
+  void sync_storages(S field) {
+    field.sync();
+  }
+
+  template<typename S0, typename ... S>
+  void sync_storages(S0 f0, S... fields) {
+    f0.sync();
+    sync_storages(fields...);
+  }
+
+  void run(storage_ijk_t in, storage_ijk_t out_a, storage_ijk_t out_b) {
+    sync_storages(in,out_a,out_b);
+    m_stencil_51.get_stencil()->run(p_in{} = in,p_tmp_a{} = m_tmp_a); 
+    m_globals.scale = (m_globals.scale * (::dawn::float_type) 2.0);
+    m_stencil_99.get_stencil()->run(p_out_a{} = out_a,p_tmp_a{} = m_tmp_a); 
+    m_globals.scale = (m_globals.scale * (::dawn::float_type) 2.0);
+    m_stencil_105.get_stencil()->run(p_in{} = in,p_tmp_b{} = m_tmp_a); 
+    m_globals.scale = (m_globals.scale * (::dawn::float_type) 2.0);
+    m_stencil_111.get_stencil()->run(p_out_b{} = out_b,p_tmp_b{} = m_tmp_a); 
+    sync_storages(in,out_a,out_b);
+  }
+
+  // Globals API
+
+  double get_scale() {
+    return m_globals.scale;
+  }
+
+  void set_scale(double scale) {
+    m_globals.scale=scale;
+    update_globals();
+  }
+
+  std::string get_name()  const {
+    return std::string(s_name);
+  }
+
+  void reset_meters() {
+m_stencil_111.get_stencil()->reset_meter();
+m_stencil_99.get_stencil()->reset_meter();
+m_stencil_105.get_stencil()->reset_meter();
+m_stencil_51.get_stencil()->reset_meter();  }
+
+  double get_total_time() {
+    double res = 0;
+    res +=m_stencil_111.get_stencil()->get_time();
+res +=m_stencil_99.get_stencil()->get_time();
+res +=m_stencil_105.get_stencil()->get_time();
+res +=m_stencil_51.get_stencil()->get_time();
+    return res;
+  }
+};
+} // namespace gt
+} // namespace dawn_generated
@@ -130,8 +130,8 @@ private:
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMin + 0+0; k <= kMin + 1+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+1; ++i) {
-        for(int j = jMin+0; j  <=  jMax+1; ++j) {
+      for(int j = jMin+0; j  <=  jMax+1; ++j) {
+        for(int i = iMin+0; i  <=  iMax+1; ++i) {
 ::dawn::float_type __local_ratio__d15_16_429 = (dp_ref(i+0, j+0, k+0) / (dp_ref(i+0, j+0, k+0) + dp_ref(i+0, j+0, k+1)));
 xfx(i+0, j+0, k+0) = (ut(i+0, j+0, k+0) + ((ut(i+0, j+0, k+0) - ut(i+0, j+0, k+1)) * __local_ratio__d15_16_429));
 ::dawn::float_type __local_ratio__d15_17_431 = (dp_ref(i+0, j+0, k+0) / (dp_ref(i+0, j+0, k+0) + dp_ref(i+0, j+0, k+1)));
@@ -165,8 +165,8 @@ yfx(i+0, j+0, k+0) = (vt(i+0, j+0, k+0) + ((vt(i+0, j+0, k+0) - vt(i+0, j+0, k+1
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMax + -1+0; k <= kMax + 0+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+1; ++i) {
-        for(int j = jMin+0; j  <=  jMax+1; ++j) {
+      for(int j = jMin+0; j  <=  jMax+1; ++j) {
+        for(int i = iMin+0; i  <=  iMax+1; ++i) {
 ::dawn::float_type __local_ratio__c74_19_433 = (dp_ref(i+0, j+0, k+-1) / (dp_ref(i+0, j+0, k+-2) + dp_ref(i+0, j+0, k+-1)));
 xfx(i+0, j+0, k+0) = (ut(i+0, j+0, k+-1) + ((ut(i+0, j+0, k+-1) - ut(i+0, j+0, k+-2)) * __local_ratio__c74_19_433));
 ::dawn::float_type __local_ratio__c74_20_434 = (dp_ref(i+0, j+0, k+-1) / (dp_ref(i+0, j+0, k+-2) + dp_ref(i+0, j+0, k+-1)));
@@ -200,8 +200,8 @@ yfx(i+0, j+0, k+0) = (vt(i+0, j+0, k+-1) + ((vt(i+0, j+0, k+-1) - vt(i+0, j+0, k
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMin + 1+0; k <= kMax + -1+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+1; ++i) {
-        for(int j = jMin+0; j  <=  jMax+1; ++j) {
+      for(int j = jMin+0; j  <=  jMax+1; ++j) {
+        for(int i = iMin+0; i  <=  iMax+1; ++i) {
 ::dawn::float_type __local_int_ratio__330_22_435 = ((::dawn::float_type) 1.0 / (dp_ref(i+0, j+0, k+-1) + dp_ref(i+0, j+0, k+0)));
 xfx(i+0, j+0, k+0) = (((dp_ref(i+0, j+0, k+0) * ut(i+0, j+0, k+-1)) + (dp_ref(i+0, j+0, k+-1) * ut(i+0, j+0, k+0))) * __local_int_ratio__330_22_435);
 ::dawn::float_type __local_int_ratio__330_23_436 = ((::dawn::float_type) 1.0 / (dp_ref(i+0, j+0, k+-1) + dp_ref(i+0, j+0, k+0)));
@@ -235,14 +235,14 @@ yfx(i+0, j+0, k+0) = (((dp_ref(i+0, j+0, k+0) * vt(i+0, j+0, k+-1)) + (dp_ref(i+
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMin + 0+0; k <= kMax + 0+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+1; ++i) {
-        for(int j = jMin+0; j  <=  jMax+1; ++j) {
+      for(int j = jMin+0; j  <=  jMax+1; ++j) {
+        for(int i = iMin+0; i  <=  iMax+1; ++i) {
 ::dawn::float_type __local_fx__389_25_437 = (xfx(i+0, j+0, k+0) * ((xfx(i+0, j+0, k+0) > (::dawn::float_type) 0.0) ? gz_x(i+-1, j+0, k+0) : gz_x(i+0, j+0, k+0)));
 ::dawn::float_type __local_fy__389_25_438 = (yfx(i+0, j+0, k+0) * ((yfx(i+0, j+0, k+0) > (::dawn::float_type) 0.0) ? gz_y(i+0, j+-1, k+0) : gz_y(i+0, j+0, k+0)));
 fx(i+0, j+0, k+0) = __local_fx__389_25_437;
 fy(i+0, j+0, k+0) = __local_fy__389_25_438;
-        }      }      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        }      }      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 gz_0(i+0, j+0, k+0) = ((((((gz_y(i+0, j+0, k+0) * area(i+0, j+0, k+0)) + fx(i+0, j+0, k+0)) - fx(i+1, j+0, k+0)) + fy(i+0, j+0, k+0)) - fy(i+0, j+1, k+0)) / ((((area(i+0, j+0, k+0) + xfx(i+0, j+0, k+0)) - xfx(i+1, j+0, k+0)) + yfx(i+0, j+0, k+0)) - yfx(i+0, j+1, k+0)));
         }      }    }}{      gridtools::data_view<storage_ijk_t> dp_ref= gridtools::make_host_view(dp_ref_);
       std::array<int,3> dp_ref_offsets{0,0,0};
@@ -273,8 +273,8 @@ gz_0(i+0, j+0, k+0) = ((((((gz_y(i+0, j+0, k+0) * area(i+0, j+0, k+0)) + fx(i+0,
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMax + -1+0; k <= kMax + 0+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 gz_0(i+0, j+0, k+0) = gz(i+0, j+0, k+0);
         }      }    }}{      gridtools::data_view<storage_ijk_t> dp_ref= gridtools::make_host_view(dp_ref_);
       std::array<int,3> dp_ref_offsets{0,0,0};
@@ -305,8 +305,8 @@ gz_0(i+0, j+0, k+0) = gz(i+0, j+0, k+0);
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMax + -1+0; k <= kMax + 0+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 ws3(i+0, j+0, k+0) = ((zs(i+0, j+0, k+0) - gz_0(i+0, j+0, k+0)) * ((::dawn::float_type) 1.0 / m_globals.dt));
         }      }    }}{      gridtools::data_view<storage_ijk_t> dp_ref= gridtools::make_host_view(dp_ref_);
       std::array<int,3> dp_ref_offsets{0,0,0};
@@ -337,8 +337,8 @@ ws3(i+0, j+0, k+0) = ((zs(i+0, j+0, k+0) - gz_0(i+0, j+0, k+0)) * ((::dawn::floa
       gridtools::data_view<tmp_storage_t> fy= gridtools::make_host_view(m_fy);
       std::array<int,3> fy_offsets{0,0,0};
     for(int k = kMin + 0+0; k <= kMax + -1+0; ++k) {
-      for(int i = iMin+0; i  <=  iMax+0; ++i) {
-        for(int j = jMin+0; j  <=  jMax+0; ++j) {
+      for(int j = jMin+0; j  <=  jMax+0; ++j) {
+        for(int i = iMin+0; i  <=  iMax+0; ++i) {
 ::dawn::float_type __local_gz_442 = (gz_0(i+0, j+0, k+1) + (::dawn::float_type) 2.0);
 gz(i+0, j+0, k+0) = ((gz(i+0, j+0, k+0) > __local_gz_442) ? gz(i+0, j+0, k+0) : __local_gz_442);
         }      }    }}      dp_ref_.sync();
@@ -98,6 +98,19 @@ TEST(ExtentsTest, ExtentCast) {
   EXPECT_FALSE(uExtent3.hasExtent());
 }
 
+TEST(ExtentsTest, ValueSemantics) {
+  Extents extents1{ast::cartesian, -1, 1, -1, 1, 0, 0};
+  Extents extents2 = extents1;
+  extents2.merge(Extents{ast::cartesian, -2, 0, 0, 0, 0, 0});
+  EXPECT_EQ(extents1, (Extents{ast::cartesian, -1, 1, -1, 1, 0, 0}));
+  EXPECT_EQ(extents2, (Extents{ast::cartesian, -2, 1, -1, 1, 0, 0}));
+
+  Extents extents3{ast::unstructured, true, Extent{0, 0}};
+  EXPECT_THROW(extents1.merge(extents3), std::bad_cast);
+  EXPECT_THROW(extents1 += extents3, std::bad_cast);
+  EXPECT_THROW((void)(extents1 == extents3), std::bad_cast);
+}
+
 TEST(ExtentsTest, PointWise) {
   Extents extents1(ast::Offsets{ast::cartesian, 0, 1, 0});
   EXPECT_FALSE(extents1.isHorizontalPointwise());
@@ -0,0 +1,99 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/IIR/IIR.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassDataLocalityMetric.h"
+#include "dawn/Serialization/IIRSerializer.h"
+#include "test/unit-test/dawn/Optimizer/TestEnvironment.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace dawn;
+
+namespace {
+
+class TestPassDataLocalityMetric : public ::testing::Test {
+protected:
+  OptimizerContext::OptimizerContextOptions options_;
+  std::unique_ptr<OptimizerContext> context_;
+  DiagnosticsEngine diag_;
+
+  explicit TestPassDataLocalityMetric() {
+    std::shared_ptr<SIR> sir = std::make_shared<SIR>(ast::GridType::Cartesian);
+    context_ = std::make_unique<OptimizerContext>(diag_, options_, sir);
+    UIDGenerator::getInstance()->reset();
+  }
+
+  std::vector<double> runTest(const std::string& filename) {
+    auto instantiation = IIRSerializer::deserialize(TestEnvironment::path_ + "/" + filename);
+
+    std::vector<double> dramBytes;
+    for(const auto& multiStage : iterateIIROver<iir::MultiStage>(*instantiation->getIIR()))
+      dramBytes.push_back(computeDRAMBytesPerPoint(*context_, *multiStage));
+    return dramBytes;
+  }
+};
+
+TEST_F(TestPassDataLocalityMetric, DRAMBytes) {
+  // field_a1 = field_a0;
+  // 8 bytes read, 8 bytes written and 8 bytes to fill the written cache line
+  EXPECT_EQ(runTest("input/ReorderTest01.iir"), std::vector<double>{24});
+}
+
+TEST_F(TestPassDataLocalityMetric, DRAMBytesCacheLines) {
+  // Rows of 800 bytes occupy 13 cache lines
+  context_->getOptions().DomainSizeI = 100;
+  EXPECT_EQ(runTest("input/ReorderTest01.iir"), std::vector<double>{24.96});
+}
+
+TEST_F(TestPassDataLocalityMetric, DRAMBytesVerticalReuse) {
+  // field_a1 = field_a0(k + 1);
+  // field_b1 = field_a0(k - 1);
+  EXPECT_DOUBLE_EQ(runTest("input/ReorderTest06.iir")[0], 40.2);
+
+  // Each of the 3 planes of field_a0 has to be loaded separately
+  context_->getHardwareConfiguration().LLCSize = 1024;
+  EXPECT_DOUBLE_EQ(runTest("input/ReorderTest06.iir")[0], 56.6);
+}
+
+TEST_F(TestPassDataLocalityMetric, DRAMBytesHorizontalReuse) {
+  // tmp = in(j - 2) + in(j + 2) + in(i - 2) + in(i + 2);
+  // out = tmp(j - 1) + tmp(j + 1) + tmp(i - 1) + tmp(i + 1);
+  const double bytes = runTest("input/LaplacianTest01.iir")[0];
+
+  // The rows at each j offset have to be loaded separately
+  context_->getHardwareConfiguration().L2CacheSize = 1024;
+  EXPECT_GT(runTest("input/LaplacianTest01.iir")[0], 2 * bytes);
+}
+
+TEST_F(TestPassDataLocalityMetric, ReadHardwareConfig) {
+  std::ofstream("TestPassDataLocalityMetric_Config.json")
+      << R"({"LLCSize": 4194304, "CacheLineSize": 128, "DRAMBandwidth": 12.5})";
+
+  HardwareConfig config;
+  config.readJSON("TestPassDataLocalityMetric_Config.json");
+  EXPECT_EQ(config.LLCSize, 4194304);
+  EXPECT_EQ(config.CacheLineSize, 128);
+  EXPECT_EQ(config.DRAMBandwidth, 12.5);
+  EXPECT_EQ(config.L2CacheSize, HardwareConfig().L2CacheSize);
+
+  std::ofstream("TestPassDataLocalityMetric_Config.json") << R"({"L4CacheSize": 1})";
+  EXPECT_THROW(config.readJSON("TestPassDataLocalityMetric_Config.json"), std::runtime_error);
+  EXPECT_THROW(config.readJSON("TestPassDataLocalityMetric_Missing.json"), std::runtime_error);
+}
+
+} // anonymous namespace
@@ -0,0 +1,75 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/IIR/StencilInstantiation.h"
+#include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassProfiler.h"
+#include "dawn/Optimizer/PassSetStageName.h"
+#include "dawn/Optimizer/PassValidation.h"
+#include "dawn/Support/Json.h"
+#include "dawn/Unittest/CompilerUtil.h"
+#include "test/unit-test/dawn/Optimizer/TestEnvironment.h"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace dawn;
+
+namespace {
+
+TEST(TestPassProfiler, RecordsPassRuns) {
+  OptimizerContext::OptimizerContextOptions options;
+  std::unique_ptr<OptimizerContext> context;
+  UIDGenerator::getInstance()->reset();
+  auto instantiation =
+      CompilerUtil::load("input/IJCacheTest01.iir", options, context, TestEnvironment::path_);
+
+  PassProfiler profiler;
+  context->setPassProfiler(&profiler);
+  context->pushBackPass<PassSetStageName>();
+  context->pushBackPass<PassValidation>();
+  context->pushBackPass<PassValidation>();
+  ASSERT_TRUE(
+      context->getPassManager().runAllPassesOnStencilInstantiation(*context, instantiation));
+
+  const auto& events = profiler.getEvents();
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(events[0].PassName, "PassSetStageName");
+  EXPECT_EQ(events[1].PassName, "PassValidation");
+  EXPECT_EQ(events[1].Invocation, 0);
+  EXPECT_EQ(events[2].Invocation, 1);
+  for(const auto& event : events) {
+    EXPECT_EQ(event.StencilName, instantiation->getName());
+    EXPECT_GE(event.Duration, 0);
+    EXPECT_GE(event.PeakRSSDelta, 0);
+  }
+  EXPECT_LE(events[0].Start + events[0].Duration, events[1].Start);
+
+  std::ostringstream summary;
+  profiler.printSummary(summary);
+  EXPECT_NE(summary.str().find("PassSetStageName"), std::string::npos);
+  EXPECT_NE(summary.str().find(instantiation->getName()), std::string::npos);
+
+  EXPECT_FALSE(profiler.writeTrace("nonexistent_directory/TestPassProfiler_Trace.json"));
+  ASSERT_TRUE(profiler.writeTrace("TestPassProfiler_Trace.json"));
+  std::ifstream file("TestPassProfiler_Trace.json");
+  json::json trace = json::json::parse(file);
+  ASSERT_EQ(trace["traceEvents"].size(), 3);
+  EXPECT_EQ(trace["traceEvents"][2]["name"], "PassValidation");
+  EXPECT_EQ(trace["traceEvents"][2]["ph"], "X");
+  EXPECT_EQ(trace["traceEvents"][2]["args"]["invocation"], 1);
+}
+
+} // namespace
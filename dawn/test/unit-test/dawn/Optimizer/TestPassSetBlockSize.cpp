@@ -0,0 +1,93 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/IIR/IIR.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassSetBlockSize.h"
+#include "dawn/Serialization/IIRSerializer.h"
+#include "test/unit-test/dawn/Optimizer/TestEnvironment.h"
+
+#include <gtest/gtest.h>
+
+using namespace dawn;
+
+namespace {
+
+class TestPassSetBlockSize : public ::testing::Test {
+protected:
+  OptimizerContext::OptimizerContextOptions options_;
+  std::unique_ptr<OptimizerContext> context_;
+  DiagnosticsEngine diag_;
+
+  explicit TestPassSetBlockSize() {
+    std::shared_ptr<SIR> sir = std::make_shared<SIR>(ast::GridType::Cartesian);
+    context_ = std::make_unique<OptimizerContext>(diag_, options_, sir);
+    UIDGenerator::getInstance()->reset();
+  }
+
+  Array3ui runTest(const std::string& filename) {
+    auto instantiation = IIRSerializer::deserialize(TestEnvironment::path_ + "/" + filename);
+
+    PassSetBlockSize setBlockSizePass(*context_);
+    EXPECT_TRUE(setBlockSizePass.run(instantiation));
+    return instantiation->getIIR()->getBlockSize();
+  }
+};
+
+TEST_F(TestPassSetBlockSize, Pointwise) {
+  // field_a1 = field_a0;
+  EXPECT_EQ(runTest("input/ReorderTest01.iir"), (Array3ui{32, 1, 4}));
+}
+
+TEST_F(TestPassSetBlockSize, HaloInI) {
+  // field_a1 = field_a0(i + 1); field_a2 = field_a1(i + 1); ...
+  EXPECT_EQ(runTest("input/ReorderTest07.iir"), (Array3ui{32, 4, 4}));
+}
+
+TEST_F(TestPassSetBlockSize, HaloInIJ) {
+  // tmp = in(j - 2) + in(j + 2) + in(i - 2) + in(i + 2);
+  // out = tmp(j - 1) + tmp(j + 1) + tmp(i - 1) + tmp(i + 1);
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (Array3ui{32, 4, 4}));
+}
+
+TEST_F(TestPassSetBlockSize, Options) {
+  context_->getOptions().BlockSizeI = 8;
+  context_->getOptions().BlockSizeJ = 8;
+  context_->getOptions().BlockSizeK = 1;
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (Array3ui{8, 8, 1}));
+}
+
+TEST_F(TestPassSetBlockSize, CostModelPointwise) {
+  // Without halos the traffic does not depend on the block size, the longest rows win
+  context_->getOptions().BlockSizeCostModel = true;
+  EXPECT_EQ(runTest("input/ReorderTest01.iir"), (Array3ui{512, 1, 4}));
+}
+
+TEST_F(TestPassSetBlockSize, CostModelHaloInI) {
+  context_->getOptions().BlockSizeCostModel = true;
+  EXPECT_EQ(runTest("input/ReorderTest07.iir"), (Array3ui{512, 1, 4}));
+}
+
+TEST_F(TestPassSetBlockSize, CostModelHaloInIJ) {
+  // The largest blocks whose working set fits into the L2 cache
+  context_->getOptions().BlockSizeCostModel = true;
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (Array3ui{256, 128, 4}));
+  context_->getHardwareConfiguration().L2CacheSize = 64 * 1024;
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (Array3ui{64, 32, 4}));
+  context_->getHardwareConfiguration().L2CacheSize = 16 * 1024;
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (Array3ui{32, 8, 4}));
+}
+
+} // anonymous namespace
@@ -41,7 +41,9 @@ protected:
     dawn::UIDGenerator::getInstance()->reset();
   }
 
-  void runTest(const std::string& filename, const std::vector<unsigned>& stageOrders) {
+  void runTest(const std::string& filename, const std::vector<unsigned>& stageOrders,
+               ReorderStrategy::Kind strategy = ReorderStrategy::Kind::Greedy,
+               int numMultiStages = -1) {
     std::string filepath = filename;
     if(!TestEnvironment::path_.empty()) {
       filepath = TestEnvironment::path_ + "/" + filepath;
@@ -67,15 +69,22 @@ protected:
     EXPECT_EQ(stageOrders.size(), prevStageIDs.size());
 
     // Expect pass to succeed...
-    PassStageReordering stageReorderPass(*context_, dawn::ReorderStrategy::Kind::Greedy);
+    PassStageReordering stageReorderPass(*context_, strategy);
     EXPECT_TRUE(stageReorderPass.run(instantiation));
 
     // Collect post-reordering stage IDs
     std::vector<int> postStageIDs;
+    int postNumMultiStages = 0;
     for(const auto& stencil : instantiation->getStencils())
-      for(const auto& multiStage : stencil->getChildren())
+      for(const auto& multiStage : stencil->getChildren()) {
+        postNumMultiStages++;
         for(const auto& stage : multiStage->getChildren())
           postStageIDs.push_back(stage->getStageID());
+      }
+
+    if(numMultiStages != -1) {
+      EXPECT_EQ(postNumMultiStages, numMultiStages);
+    }
 
     ASSERT_EQ(prevStageIDs.size(), postStageIDs.size());
     for(int i = 0; i < stageOrders.size(); i++) {
@@ -158,4 +167,24 @@ TEST_F(TestPassStageReordering, ReorderTest7) {
   runTest("input/ReorderTest07.iir", {0, 1, 2, 3, 4, 5, 6});
 }
 
+TEST_F(TestPassStageReordering, PartitioningTest1) {
+  runTest("input/ReorderTest01.iir", {0}, ReorderStrategy::Kind::Partitioning, 1);
+}
+
+TEST_F(TestPassStageReordering, PartitioningTest2) {
+  // All stages fit into a single multi-stage, hence there is no need to move any of them
+  runTest("input/ReorderTest02.iir", {0, 1, 2, 3}, ReorderStrategy::Kind::Partitioning, 1);
+}
+
+TEST_F(TestPassStageReordering, PartitioningTest4) {
+  // The vertical read-before-write conflicts of the two regions require a cut
+  runTest("input/ReorderTest04.iir", {0, 1, 2, 3}, ReorderStrategy::Kind::Partitioning, 2);
+}
+
+TEST_F(TestPassStageReordering, PartitioningTest7) {
+  // Each multi-stage holds at most 3 halo lines (the default of MaxHaloPoints)
+  runTest("input/ReorderTest07.iir", {0, 1, 2, 3, 4, 5, 6}, ReorderStrategy::Kind::Partitioning,
+          3);
+}
+
 } // anonymous namespace
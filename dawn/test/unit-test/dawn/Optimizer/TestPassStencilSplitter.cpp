@@ -0,0 +1,111 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/IIR/IIR.h"
+#include "dawn/IIR/StencilInstantiation.h"
+#include "dawn/Optimizer/OptimizerContext.h"
+#include "dawn/Optimizer/PassSetStageGraph.h"
+#include "dawn/Optimizer/PassStencilSplitter.h"
+#include "dawn/Serialization/IIRSerializer.h"
+#include "test/unit-test/dawn/Optimizer/TestEnvironment.h"
+
+#include <gtest/gtest.h>
+
+using namespace dawn;
+
+namespace {
+
+class TestPassStencilSplitter : public ::testing::Test {
+protected:
+  OptimizerContext::OptimizerContextOptions options_;
+  std::unique_ptr<OptimizerContext> context_;
+  DiagnosticsEngine diag_;
+
+  explicit TestPassStencilSplitter() {
+    options_.SplitStencils = true;
+    std::shared_ptr<SIR> sir = std::make_shared<SIR>(ast::GridType::Cartesian);
+    context_ = std::make_unique<OptimizerContext>(diag_, options_, sir);
+    UIDGenerator::getInstance()->reset();
+  }
+
+  /// Split the stencil and return the number of stages of each resulting stencil
+  std::vector<int> runTest(const std::string& filename, int maxFields = 40) {
+    auto instantiation = IIRSerializer::deserialize(TestEnvironment::path_ + "/" + filename);
+
+    PassSetStageGraph stageGraphPass(*context_);
+    EXPECT_TRUE(stageGraphPass.run(instantiation));
+
+    std::vector<int> prevStageIDs;
+    for(const auto& stage : iterateIIROver<iir::Stage>(*instantiation->getIIR()))
+      prevStageIDs.push_back(stage->getStageID());
+
+    PassStencilSplitter stencilSplitterPass(*context_, maxFields);
+    EXPECT_TRUE(stencilSplitterPass.run(instantiation));
+
+    // The stages keep their order
+    std::vector<int> postStageIDs;
+    for(const auto& stage : iterateIIROver<iir::Stage>(*instantiation->getIIR()))
+      postStageIDs.push_back(stage->getStageID());
+    EXPECT_EQ(prevStageIDs, postStageIDs);
+
+    std::vector<int> numStages;
+    for(const auto& stencil : instantiation->getStencils())
+      numStages.push_back(stencil->getNumStages());
+    return numStages;
+  }
+};
+
+TEST_F(TestPassStencilSplitter, Disabled) {
+  // field_a1 = field_a0(i + 1); field_a2 = field_a1(i + 1); ...
+  context_->getOptions().SplitStencils = false;
+  EXPECT_EQ(runTest("input/ReorderTest07.iir", 2), (std::vector<int>{7}));
+}
+
+TEST_F(TestPassStencilSplitter, FitsIntoCache) {
+  EXPECT_EQ(runTest("input/ReorderTest07.iir"), (std::vector<int>{7}));
+}
+
+TEST_F(TestPassStencilSplitter, MaxFields) {
+  // Every stage adds one field to the two fields of the first stage
+  EXPECT_EQ(runTest("input/ReorderTest07.iir", 4), (std::vector<int>{3, 3, 1}));
+}
+
+TEST_F(TestPassStencilSplitter, CacheCapacity) {
+  // Every field is accessed with at most one halo line in i, i.e a 32x4x4 block keeps at most 4
+  // rows of 33 points, i.e 5 cache lines each, of every field in the cache. Hence three fields fit
+  // into the cache but four do not.
+  context_->getHardwareConfiguration().L2CacheSize = 3 * 4 * 5 * 64;
+  EXPECT_EQ(runTest("input/ReorderTest07.iir"), (std::vector<int>{2, 2, 2, 1}));
+}
+
+TEST_F(TestPassStencilSplitter, CacheCapacityOfBlockSize) {
+  // The working sets are estimated with the block size PassSetBlockSize chooses later on: a
+  // 16x4x4 block keeps 4 rows of 17 points, i.e 3 cache lines each, of every field in the cache,
+  // hence five fields fit into the cache
+  context_->getOptions().BlockSizeI = 16;
+  context_->getOptions().BlockSizeJ = 4;
+  context_->getOptions().BlockSizeK = 4;
+  context_->getHardwareConfiguration().L2CacheSize = 3 * 4 * 5 * 64;
+  EXPECT_EQ(runTest("input/ReorderTest07.iir"), (std::vector<int>{4, 3}));
+}
+
+TEST_F(TestPassStencilSplitter, CacheCapacityOfCostModelBlockSize) {
+  // The cost model of PassSetBlockSize picks a block whose working set fits into the cache
+  context_->getOptions().BlockSizeCostModel = true;
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (std::vector<int>{2}));
+  context_->getHardwareConfiguration().L2CacheSize = 16 * 1024;
+  EXPECT_EQ(runTest("input/LaplacianTest01.iir"), (std::vector<int>{2}));
+}
+
+} // anonymous namespace
@@ -21,8 +21,12 @@
 #include "dawn/IIR/StencilInstantiation.h"
 #include "dawn/Optimizer/PassMultiStageSplitter.h"
 #include "dawn/Optimizer/PassTemporaryToStencilFunction.h"
+#include "dawn/SIR/ASTExpr.h"
+#include "dawn/SIR/ASTStmt.h"
+#include "dawn/SIR/SIR.h"
 #include "dawn/Serialization/IIRSerializer.h"
 #include "dawn/Unittest/CompilerUtil.h"
+#include "dawn/Unittest/IIRBuilder.h"
 #include "test/unit-test/dawn/Optimizer/TestEnvironment.h"
 
 #include <fstream>
@@ -45,8 +49,12 @@ protected:
   std::unique_ptr<OptimizerContext> context_;
 
   std::shared_ptr<iir::StencilInstantiation> runPass(const std::string& filename) {
+    return runPass(IIRSerializer::deserialize(filename));
+  }
+
+  std::shared_ptr<iir::StencilInstantiation>
+  runPass(std::shared_ptr<iir::StencilInstantiation> instantiation) {
     context_->getDiagnostics().clear();
-    std::shared_ptr<iir::StencilInstantiation> instantiation = IIRSerializer::deserialize(filename);
     EXPECT_TRUE(instantiation->getIIR()->getChildren().size() == 1);
     for(auto& stmt : iterateIIROverStmt(*instantiation->getIIR())) {
       stmt->getData<iir::IIRStmtData>().StackTrace = std::vector<dawn::ast::StencilCall*>();
@@ -94,4 +102,107 @@ TEST_F(TestPassTemporaryToFunction, TmpToFunDont) {
   ASSERT_TRUE(funs.size() == 0);
 }
 
+std::shared_ptr<iir::StencilInstantiation> makeTmpReadAtTwoOffsets() {
+  /*
+    tmp = in * 2;
+    out = tmp[i - 1] + tmp[i + 1];
+  */
+  using namespace iir;
+  CartesianIIRBuilder b;
+  auto in = b.field("in", FieldType::ijk);
+  auto out = b.field("out", FieldType::ijk);
+  auto tmp = b.tmpField("tmp", FieldType::ijk);
+
+  auto defineTmp = b.assignExpr(b.at(tmp), b.binaryExpr(b.at(in), b.lit(2.), Op::multiply));
+  auto readTmp =
+      b.assignExpr(b.at(out), b.binaryExpr(b.at(tmp, {-1, 0, 0}), b.at(tmp, {1, 0, 0})));
+
+  return b.build(
+      "tmp_two_offsets",
+      b.stencil(b.multistage(
+          LoopOrderKind::Parallel,
+          b.stage(b.doMethod(sir::Interval::Start, sir::Interval::End,
+                             b.stmt(std::move(defineTmp)))),
+          b.stage(b.doMethod(sir::Interval::Start, sir::Interval::End,
+                             b.stmt(std::move(readTmp)))))));
+}
+
+TEST_F(TestPassTemporaryToFunction, RecomputeCheaperThanStore) {
+  // one additional multiplication per grid point is cheaper than storing and reloading tmp
+  auto instantiation = runPass(makeTmpReadAtTwoOffsets());
+  // tmp is computed on the fly at both offsets
+  ASSERT_EQ(instantiation->getIIR()->getStencilFunctions().size(), 2);
+}
+
+TEST_F(TestPassTemporaryToFunction, StoreCheaperThanRecompute) {
+  // on a machine with a low arithmetic throughput, the memory round trip is cheaper
+  context_->getHardwareConfiguration().FlopRate = 1;
+  auto instantiation = runPass(makeTmpReadAtTwoOffsets());
+  ASSERT_EQ(instantiation->getIIR()->getStencilFunctions().size(), 0);
+}
+
+std::shared_ptr<iir::StencilInstantiation> makeTmpReadInStencilFunction() {
+  /*
+    stencil_function avg { storage f; Do { return f[i - 1] + f[i + 1]; } }
+    tmp = in * 2;
+    out = avg(tmp);
+  */
+  auto makeField = [](const std::string& name, bool isTemporary = false) {
+    auto field = std::make_shared<sir::Field>(
+        name, sir::FieldDimensions(sir::HorizontalFieldDimension(ast::cartesian, {true, true}),
+                                   true));
+    field->IsTemporary = isTemporary;
+    return field;
+  };
+  auto sir = std::make_shared<SIR>(ast::GridType::Cartesian);
+
+  auto avg = std::make_shared<sir::StencilFunction>();
+  avg->Name = "avg";
+  avg->Args.push_back(makeField("f"));
+  avg->Asts.push_back(std::make_shared<sir::AST>(
+      sir::makeBlockStmt(std::vector<std::shared_ptr<sir::Stmt>>{
+          sir::makeReturnStmt(std::make_shared<sir::BinaryOperator>(
+              std::make_shared<sir::FieldAccessExpr>("f", ast::Offsets{ast::cartesian, -1, 0, 0}),
+              "+",
+              std::make_shared<sir::FieldAccessExpr>("f",
+                                                     ast::Offsets{ast::cartesian, 1, 0, 0})))})));
+  sir->StencilFunctions.push_back(avg);
+
+  auto stencil = std::make_shared<sir::Stencil>();
+  stencil->Name = "tmp_in_stencil_function";
+  stencil->Fields = {makeField("in"), makeField("out"), makeField("tmp", true)};
+
+  auto defineTmp = sir::makeExprStmt(std::make_shared<sir::AssignmentExpr>(
+      std::make_shared<sir::FieldAccessExpr>("tmp"),
+      std::make_shared<sir::BinaryOperator>(
+          std::make_shared<sir::FieldAccessExpr>("in"), "*",
+          std::make_shared<sir::LiteralAccessExpr>("2.0", BuiltinTypeID::Double))));
+  auto call = std::make_shared<sir::StencilFunCallExpr>("avg");
+  call->getArguments().push_back(std::make_shared<sir::FieldAccessExpr>("tmp"));
+  auto readTmp = sir::makeExprStmt(
+      std::make_shared<sir::AssignmentExpr>(std::make_shared<sir::FieldAccessExpr>("out"), call));
+
+  auto verticalRegion = std::make_shared<sir::VerticalRegion>(
+      std::make_shared<sir::AST>(
+          sir::makeBlockStmt(std::vector<std::shared_ptr<sir::Stmt>>{defineTmp, readTmp})),
+      std::make_shared<sir::Interval>(sir::Interval::Start, sir::Interval::End),
+      sir::VerticalRegion::LoopOrderKind::Forward);
+  stencil->StencilDescAst =
+      std::make_shared<sir::AST>(sir::makeBlockStmt(std::vector<std::shared_ptr<sir::Stmt>>{
+          sir::makeVerticalRegionDeclStmt(verticalRegion)}));
+  sir->Stencils.push_back(stencil);
+
+  DawnCompiler compiler;
+  return compiler.lowerToIIR(sir).at("tmp_in_stencil_function");
+}
+
+TEST_F(TestPassTemporaryToFunction, StoreTmpReadInStencilFunction) {
+  // avg reads tmp at two offsets, hence tmp would be computed twice per grid point, which costs
+  // more than the memory round trip on a machine with a low arithmetic throughput
+  context_->getHardwareConfiguration().FlopRate = 1;
+  auto instantiation = runPass(makeTmpReadInStencilFunction());
+  // only avg itself
+  ASSERT_EQ(instantiation->getIIR()->getStencilFunctions().size(), 1);
+}
+
 } // anonymous namespace
\ No newline at end of file
@@ -0,0 +1,63 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                          _
+//                         | |
+//                       __| | __ ___      ___ ___
+//                      / _` |/ _` \ \ /\ / / '_  |
+//                     | (_| | (_| |\ V  V /| | | |
+//                      \__,_|\__,_| \_/\_/ |_| |_| - Compiler Toolchain
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+
+#include "dawn/Support/UIDGenerator.h"
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+
+namespace dawn {
+
+TEST(UIDGenerator, Reserve) {
+  UIDGenerator* generator = UIDGenerator::getInstance();
+  generator->reset();
+  EXPECT_EQ(generator->reserve(10), 1);
+  EXPECT_EQ(generator->get(), 11);
+
+  // Reserving beyond the largest identifier fails and leaves the generator untouched
+  generator->set(std::numeric_limits<int>::max() - 5);
+  EXPECT_THROW(generator->reserve(10), std::runtime_error);
+  EXPECT_EQ(generator->reserve(5), std::numeric_limits<int>::max() - 5);
+  generator->reset();
+}
+
+TEST(UIDGenerator, ScopedBlock) {
+  UIDGenerator* generator = UIDGenerator::getInstance();
+  generator->reset();
+  const int first = generator->reserve(4);
+  {
+    UIDGenerator::ScopedBlock block(first, 2);
+    EXPECT_EQ(generator->get(), first);
+    EXPECT_EQ(generator->get(), first + 1);
+    // The exhausted block continues with a block reserved from the generator
+    EXPECT_EQ(generator->get(), first + 4);
+    EXPECT_EQ(generator->get(), first + 5);
+  }
+  EXPECT_EQ(generator->get(), first + 6);
+  generator->reset();
+}
+
+TEST(UIDGenerator, Rewind) {
+  UIDGenerator* generator = UIDGenerator::getInstance();
+  generator->reset();
+  const int first = generator->reserve(10);
+  // Only the tail of the last reservation can be given back
+  generator->reserve(10);
+  EXPECT_FALSE(generator->rewind(first + 4, first + 10));
+  EXPECT_TRUE(generator->rewind(first + 14, first + 20));
+  EXPECT_EQ(generator->get(), first + 14);
+  generator->reset();
+}
+
+} // namespace dawn
@@ -269,4 +269,77 @@ TEST_F(TestAtlasInterface, Intp) {
   ASSERT_TRUE(nbhsValidAndEqual(intpLoRef, intpLo));
   ASSERT_TRUE(nbhsValidAndEqual(intpHiRef, intpHi));
 }
+
+TEST_F(TestAtlasInterface, NeighborTable) {
+  std::vector<std::vector<dawn::LocationType>> chains{
+      {dawn::LocationType::Edges, dawn::LocationType::Cells, dawn::LocationType::Vertices},
+      {dawn::LocationType::Vertices, dawn::LocationType::Cells, dawn::LocationType::Edges,
+       dawn::LocationType::Cells},
+      {dawn::LocationType::Cells, dawn::LocationType::Edges, dawn::LocationType::Cells,
+       dawn::LocationType::Edges, dawn::LocationType::Cells}};
+
+  for(const auto& chain : chains) {
+    const atlasInterface::NeighborTable& table =
+        atlasInterface::getNeighborTable(getMesh(), chain);
+    // a second lookup must hit the cache
+    ASSERT_EQ(&table, &atlasInterface::getNeighborTable(getMesh(), chain));
+
+    const int size = atlasInterface::numElements(getMesh(), chain.front());
+    ASSERT_EQ(table.offsets.size(), size + 1);
+    for(int idx = 0; idx < size; idx++) {
+      std::vector<int> fromTable{table.indices.begin() + table.offsets[idx],
+                                 table.indices.begin() + table.offsets[idx + 1]};
+      ASSERT_EQ(fromTable, atlasInterface::getNeighbors(getMesh(), chain, idx));
+    }
+  }
+}
+
+TEST_F(TestAtlasInterface, ReduceStaticChain) {
+  using dawn::LocationType;
+  const std::vector<LocationType> chain{LocationType::Edges, LocationType::Cells,
+                                        LocationType::Vertices};
+  const atlasInterface::NeighborTable& table =
+      atlasInterface::getNeighborTable<LocationType::Edges, LocationType::Cells,
+                                       LocationType::Vertices>(getMesh());
+  // compile-time and runtime chains share the cached table
+  ASSERT_EQ(&table, &atlasInterface::getNeighborTable(getMesh(), chain));
+
+  std::array<double, 6> weights{1., 2., 3., 4., 5., 6.};
+  for(int idx = 0; idx < atlasInterface::numElements(getMesh(), LocationType::Edges); idx++) {
+    auto sumIdx = [](int& lhs, int nbh) { lhs += nbh; };
+    auto sumWeighted = [](double& lhs, int nbh, double w) { lhs += w * nbh; };
+    ASSERT_EQ((atlasInterface::reduce<LocationType::Edges, LocationType::Cells,
+                                      LocationType::Vertices>(atlasInterface::atlasTag{},
+                                                              getMesh(), idx, 0, sumIdx)),
+              atlasInterface::reduce(atlasInterface::atlasTag{}, getMesh(), idx, 0, chain,
+                                     sumIdx));
+    ASSERT_EQ((atlasInterface::reduce<LocationType::Edges, LocationType::Cells,
+                                      LocationType::Vertices>(
+                  atlasInterface::atlasTag{}, getMesh(), idx, 0., sumWeighted, weights)),
+              atlasInterface::reduce(atlasInterface::atlasTag{}, getMesh(), idx, 0., chain,
+                                     sumWeighted, std::vector<double>{1., 2., 3., 4., 5., 6.}));
+  }
+}
+
+TEST_F(TestAtlasInterface, NeighborTableOfDestroyedMesh) {
+  // meshes that are destroyed right away, a later mesh likely reuses the address of an earlier one
+  // and must not get its tables
+  for(int n : {4, 6, 8}) {
+    auto grid = atlas::StructuredGrid{atlas::grid::LinearSpacing(0, n, n, false),
+                                      atlas::grid::LinearSpacing(0, n, n, false)};
+    atlas::Mesh mesh = atlas::StructuredMeshGenerator{}.generate(grid);
+    atlas::mesh::actions::build_edges(mesh, atlas::util::Config("pole_edges", false));
+    atlas::mesh::actions::build_element_to_edge_connectivity(mesh);
+
+    std::vector<dawn::LocationType> chain{dawn::LocationType::Cells, dawn::LocationType::Edges};
+    const atlasInterface::NeighborTable& table = atlasInterface::getNeighborTable(mesh, chain);
+    ASSERT_EQ(table.offsets.size(), mesh.cells().size() + 1);
+    for(int idx = 0; idx < mesh.cells().size(); idx++) {
+      std::vector<int> fromTable{table.indices.begin() + table.offsets[idx],
+                                 table.indices.begin() + table.offsets[idx + 1]};
+      ASSERT_EQ(fromTable, atlasInterface::getNeighbors(mesh, chain, idx));
+    }
+  }
+}
+
 } // namespace
\ No newline at end of file
@@ -182,4 +182,154 @@ TEST(TestToylibInterface, Intp) {
   ASSERT_TRUE(nbhsValidAndEqual(intpHi, intpHiRef));
 }
 
+TEST(TestToylibInterface, NeighborTable) {
+  int w = 10;
+  toylib::Grid mesh(w, w, false, 1., 1., true);
+  std::vector<dawn::LocationType> chain{dawn::LocationType::Edges, dawn::LocationType::Cells,
+                                        dawn::LocationType::Vertices};
+
+  const toylib::NeighborTable& table = toylibInterface::getNeighborTable(mesh, chain);
+  // the compile time chain needs to be keyed the same as the runtime one
+  ASSERT_EQ(&table, &(toylibInterface::getNeighborTable<dawn::LocationType::Edges,
+                                                         dawn::LocationType::Cells,
+                                                         dawn::LocationType::Vertices>(mesh)));
+
+  ASSERT_EQ(table.offsets.size(), mesh.all_edges().size() + 1);
+  for(const auto& e : mesh.edges()) {
+    std::vector<int> fromTable{table.indices.begin() + table.offsets[e.get().id()],
+                               table.indices.begin() + table.offsets[e.get().id() + 1]};
+    std::vector<int> ref;
+    for(auto v : toylibInterface::getNeighbors(mesh, chain, &e.get())) {
+      ref.push_back(v->id());
+    }
+    ASSERT_EQ(fromTable, ref);
+  }
+}
+
+TEST(TestToylibInterface, ReduceStaticChain) {
+  int w = 10;
+  toylib::Grid mesh(w, w, false, 1., 1., true);
+  std::vector<dawn::LocationType> chain{dawn::LocationType::Vertices, dawn::LocationType::Cells,
+                                        dawn::LocationType::Edges};
+  auto sumIds = [](int& lhs, auto e) { return lhs += e->id(); };
+  auto sumWeightedIds = [](int& lhs, auto e, int weight) {
+    return lhs += weight * e->id();
+  };
+  std::array<int, 12> weights;
+  std::fill(weights.begin(), weights.end(), 2);
+
+  for(const auto& v : mesh.vertices()) {
+    int dynamicSum = toylibInterface::reduce(toylibInterface::toylibTag{}, mesh, &v, 0, chain,
+                                             sumIds);
+    int staticSum =
+        toylibInterface::reduce<dawn::LocationType::Vertices, dawn::LocationType::Cells,
+                                dawn::LocationType::Edges>(toylibInterface::toylibTag{}, mesh, &v,
+                                                           0, sumIds);
+    int staticWeightedSum =
+        toylibInterface::reduce<dawn::LocationType::Vertices, dawn::LocationType::Cells,
+                                dawn::LocationType::Edges>(toylibInterface::toylibTag{}, mesh, &v,
+                                                           0, sumWeightedIds, weights);
+    ASSERT_EQ(dynamicSum, staticSum);
+    ASSERT_EQ(2 * dynamicSum, staticWeightedSum);
+  }
+}
+
+TEST(TestToylibInterface, FieldStorage) {
+  int w = 10;
+  int kSize = 5;
+  int sparseSize = 3;
+  toylib::Grid mesh(w, w, false, 1., 1., true);
+
+  for(auto layout : {toylib::storage_layout::horizontal_major, toylib::storage_layout::k_major}) {
+    toylib::EdgeData<double> dense(mesh, kSize, layout);
+    toylib::SparseEdgeData<double> sparse(mesh, kSize, sparseSize, layout);
+    ASSERT_EQ(dense.size(), mesh.all_edges().size() * kSize);
+    ASSERT_EQ(sparse.size(), mesh.all_edges().size() * kSize * sparseSize);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(dense.data()) % 64, 0);
+
+    // every (element, level, sparse index) maps to a distinct value of the buffer
+    double value = 0.;
+    for(toylib::Edge const& e : mesh.edges()) {
+      for(int k = 0; k < kSize; k++) {
+        dense(e, k) = value;
+        for(int s = 0; s < sparseSize; s++) {
+          sparse(e, s, k) = value * sparseSize + s;
+        }
+        value += 1.;
+      }
+    }
+    value = 0.;
+    for(toylib::Edge const& e : mesh.edges()) {
+      for(int k = 0; k < kSize; k++) {
+        ASSERT_EQ(dense(e, k), value);
+        for(int s = 0; s < sparseSize; s++) {
+          ASSERT_EQ(sparse(e, s, k), value * sparseSize + s);
+        }
+        value += 1.;
+      }
+    }
+
+    // the sparse dimension is innermost, the layout selects the next one
+    toylib::Edge const& e0 = mesh.edges()[0];
+    toylib::Edge const& e = mesh.edges()[1];
+    ASSERT_EQ(&sparse(e, 1, 0) - &sparse(e, 0, 0), 1);
+    if(layout == toylib::storage_layout::k_major) {
+      ASSERT_EQ(&dense(e, 1) - &dense(e, 0), 1);
+      ASSERT_EQ(&dense(e, 0) - &dense(e0, 0), (e.id() - e0.id()) * kSize);
+      ASSERT_EQ(&sparse(e, 0, 1) - &sparse(e, 0, 0), sparseSize);
+    } else {
+      ASSERT_EQ(&dense(e, 0) - &dense(e0, 0), e.id() - e0.id());
+      ASSERT_EQ(&sparse(e, 0, 0) - &sparse(e0, 0, 0), (e.id() - e0.id()) * sparseSize);
+    }
+  }
+}
+
+TEST(TestToylibInterface, ConnectivityTables) {
+  int w = 10;
+  toylib::Grid mesh(w, w, false, 1., 1., true);
+
+  auto checkTable = [](auto const& table, auto const& elem, auto const& neighbors) {
+    int i = 0;
+    for(auto nbh : neighbors)
+      ASSERT_EQ(table(elem.id(), i++), nbh->id());
+    for(; i < table.width; i++)
+      ASSERT_EQ(table(elem.id(), i), -1);
+  };
+  for(const auto& f : mesh.faces()) {
+    checkTable(mesh.face_edge_table(), f, f.edges());
+    checkTable(mesh.face_vertex_table(), f, f.vertices());
+  }
+  for(toylib::Edge const& e : mesh.edges()) {
+    checkTable(mesh.edge_face_table(), e, e.faces());
+    checkTable(mesh.edge_vertex_table(), e, e.vertices());
+  }
+  for(const auto& v : mesh.vertices()) {
+    checkTable(mesh.vertex_edge_table(), v, v.edges());
+    checkTable(mesh.vertex_face_table(), v, v.faces());
+  }
+
+  std::vector<int> edgeIds;
+  for(toylib::Edge const& e : mesh.edges())
+    edgeIds.push_back(e.id());
+  ASSERT_EQ(edgeIds, toylibInterface::getEdges(toylibInterface::toylibTag{}, mesh));
+  ASSERT_EQ(toylibInterface::getCells(toylibInterface::toylibTag{}, mesh).size(),
+            mesh.faces().size());
+}
+
+TEST(TestToylibInterface, ReduceIds) {
+  int w = 10;
+  toylib::Grid mesh(w, w, false, 1., 1., true);
+  std::vector<dawn::LocationType> chain{dawn::LocationType::Cells, dawn::LocationType::Edges};
+  auto sumIds = [](int& lhs, int id) { return lhs += id; };
+  auto sumElemIds = [](int& lhs, auto e) { return lhs += e->id(); };
+
+  for(int cellId : toylibInterface::getCells(toylibInterface::toylibTag{}, mesh)) {
+    const toylib::Face& cell = mesh.faces()[cellId];
+    ASSERT_EQ(toylibInterface::reduce(toylibInterface::toylibTag{}, mesh, cellId, 0, chain,
+                                      sumIds),
+              toylibInterface::reduce(toylibInterface::toylibTag{}, mesh, &cell, 0, chain,
+                                      sumElemIds));
+  }
+}
+
 } // namespace
\ No newline at end of file
@@ -156,6 +156,10 @@ void GTClangASTConsumer::HandleTranslationUnit(clang::ASTContext& ASTContext) {
   if(context_->getOptions().StageReordering || context_->getOptions().DefaultOptimization)
     passGroup.push_back(dawn::PassGroup::StageReordering);
 
+  if(context_->getOptions().StencilSplitting ||
+     (context_->getOptions().DefaultOptimization && context_->getOptions().SplitStencils))
+    passGroup.push_back(dawn::PassGroup::StencilSplitting);
+
   if(context_->getOptions().StageMerger || context_->getOptions().DefaultOptimization)
     passGroup.push_back(dawn::PassGroup::StageMerger);
 
@@ -192,6 +196,8 @@ void GTClangASTConsumer::HandleTranslationUnit(clang::ASTContext& ASTContext) {
   if(!context_->getOptions().DisableOptimization && passGroup.size() == 0) {
     passGroup.push_back(dawn::PassGroup::SetStageName);
     passGroup.push_back(dawn::PassGroup::StageReordering);
+    if(context_->getOptions().SplitStencils)
+      passGroup.push_back(dawn::PassGroup::StencilSplitting);
     passGroup.push_back(dawn::PassGroup::StageMerger);
     passGroup.push_back(dawn::PassGroup::SetCaches);
     passGroup.push_back(dawn::PassGroup::SetBlockSize);
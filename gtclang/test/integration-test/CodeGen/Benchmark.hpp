@@ -0,0 +1,125 @@
+//===--------------------------------------------------------------------------------*- C++ -*-===//
+//                         _       _
+//                        | |     | |
+//                    __ _| |_ ___| | __ _ _ __   __ _
+//                   / _` | __/ __| |/ _` | '_ \ / _` |
+//                  | (_| | || (__| | (_| | | | | (_| |
+//                   \__, |\__\___|_|\__,_|_| |_|\__, | - GridTools Clang DSL
+//                    __/ |                       __/ |
+//                   |___/                       |___/
+//
+//
+//  This file is distributed under the MIT License (MIT).
+//  See LICENSE.txt for details.
+//
+//===------------------------------------------------------------------------------------------===//
+#ifndef TEST_INTEGRATIONTEST_CODEGEN_BENCHMARK_H
+#define TEST_INTEGRATIONTEST_CODEGEN_BENCHMARK_H
+
+#include "driver-includes/defs.hpp"
+#include "driver-includes/domain.hpp"
+#include "driver-includes/timer_x86.hpp"
+#include "test/integration-test/CodeGen/Options.hpp"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace dawn {
+
+/**
+ * @struct stencil_cost
+ * Nominal work of a stencil per grid point of the compute domain
+ */
+struct stencil_cost {
+  /// Reads and writes of (non-temporary) 3D fields, i.e. the compulsory memory traffic in units of
+  /// `sizeof(::dawn::float_type)`
+  int field_accesses;
+  /// Floating point operations (including sqrt, min and max)
+  int flops;
+};
+
+/**
+ * Domain sizes of the benchmark sweep
+ *
+ * The horizontal size of `Options::m_size` is halved down to 16 points (smallest size first),
+ * the vertical size is kept.
+ */
+inline std::vector<std::array<unsigned int, 3>> benchmark_sizes() {
+  const int* size = Options::getInstance().m_size;
+  std::vector<std::array<unsigned int, 3>> sizes;
+  for(int i = size[0], j = size[1]; sizes.empty() || (i >= 16 && j >= 16); i /= 2, j /= 2)
+    sizes.insert(sizes.begin(), std::array<unsigned int, 3>{{unsigned(i), unsigned(j),
+                                                             unsigned(size[2])}});
+  return sizes;
+}
+
+/**
+ * Time `run` on the domain `dom` and report the median and minimum time, the effective bandwidth
+ * and the floating point throughput
+ *
+ * `run` is executed `Options::m_warmup` times untimed and `Options::m_repetitions` times timed.
+ */
+template <class Run>
+void benchmark(const std::string& stencil, const std::string& backend,
+               const gridtools::dawn::domain& dom, const stencil_cost& cost, Run&& run) {
+  const Options& options = Options::getInstance();
+
+  for(int rep = 0; rep < options.m_warmup; ++rep)
+    run();
+
+  gridtools::dawn::timer_x86 timer(stencil);
+  std::vector<double> times;
+  for(int rep = 0; rep < std::max(options.m_repetitions, 1); ++rep) {
+    timer.reset();
+    timer.start();
+    run();
+    timer.pause();
+    times.push_back(timer.total_time());
+  }
+  std::sort(times.begin(), times.end());
+  const double median = times.size() % 2 ? times[times.size() / 2]
+                                         : 0.5 * (times[times.size() / 2 - 1] +
+                                                  times[times.size() / 2]);
+  const double min = times.front();
+
+  const double points = double(dom.isize() - dom.iminus() - dom.iplus()) *
+                        (dom.jsize() - dom.jminus() - dom.jplus()) * dom.ksize();
+  const double bandwidth = points * cost.field_accesses * sizeof(::dawn::float_type) / median;
+  const double gflops = points * cost.flops / median * 1e-9;
+
+  const std::string& filename = options.m_benchmark_output;
+  const bool json =
+      filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+
+  // The CSV header is written once per file (or once per run on stdout)
+  static bool printedHeader = false;
+  std::ofstream file;
+  if(!filename.empty()) {
+    // An existing yet empty file has no header either
+    std::ifstream existing(filename, std::ios::ate);
+    printedHeader = existing.good() && existing.tellg() > 0;
+    file.open(filename, std::ios::out | std::ios::app);
+  }
+  std::ostream& os = filename.empty() ? std::cout : file;
+  if(!json && !printedHeader)
+    os << "stencil,backend,isize,jsize,ksize,repetitions,median_s,min_s,bandwidth_GBs,gflops\n";
+  printedHeader = true;
+
+  if(json)
+    os << "{\"stencil\": \"" << stencil << "\", \"backend\": \"" << backend
+       << "\", \"isize\": " << dom.isize() << ", \"jsize\": " << dom.jsize()
+       << ", \"ksize\": " << dom.ksize() << ", \"repetitions\": " << times.size()
+       << ", \"median_s\": " << median << ", \"min_s\": " << min
+       << ", \"bandwidth_GBs\": " << bandwidth * 1e-9 << ", \"gflops\": " << gflops << "}\n";
+  else
+    os << stencil << "," << backend << "," << dom.isize() << "," << dom.jsize() << ","
+       << dom.ksize() << "," << times.size() << "," << median << "," << min << ","
+       << bandwidth * 1e-9 << "," << gflops << "\n";
+}
+
+} // namespace dawn
+
+#endif
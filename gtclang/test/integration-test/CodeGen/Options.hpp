@@ -31,6 +31,9 @@ private:
       m_size[i] = 0;
     }
     m_verify = true;
+    m_benchmark = false;
+    m_warmup = 2;
+    m_repetitions = 10;
   }
   Options(const Options&) {}
   ~Options() {}
@@ -40,6 +43,14 @@ public:
 
   int m_size[4] = {12, 12, 12, 10};
   bool m_verify;
+
+  /// Benchmark mode (see Benchmark.hpp): sweep of domain sizes bounded by `m_size`
+  bool m_benchmark;
+  int m_warmup;
+  int m_repetitions;
+  /// Results are appended as CSV, or as JSON lines if the file name ends with `.json`. Printed to
+  /// stdout if empty
+  std::string m_benchmark_output;
 };
 } // namespace dawn
 
@@ -14,6 +14,7 @@
 //
 //===------------------------------------------------------------------------------------------===//
 #include <gtest/gtest.h>
+#include <string>
 #include "test/integration-test/CodeGen/Options.hpp"
 
 using namespace dawn;
@@ -23,12 +24,23 @@ int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
 
   if(argc < 4) {
-    printf("Usage: <pack>_stencil_<whatever> dimx dimy dimz\n where args are integer sizes of the data fields\n");
+    printf("Usage: <pack>_stencil_<whatever> dimx dimy dimz [--benchmark] [--warmup=N] [--repetitions=N] [--benchmark-output=<file>]\n where args are integer sizes of the data fields\n");
     return 1;
   }
 
   for(int i = 0; i != 3; ++i) {
     Options::getInstance().m_size[i] = atoi(argv[i + 1]);
   }
+  for(int i = 4; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if(arg == "--benchmark")
+      Options::getInstance().m_benchmark = true;
+    else if(arg.compare(0, 9, "--warmup=") == 0)
+      Options::getInstance().m_warmup = atoi(arg.c_str() + 9);
+    else if(arg.compare(0, 14, "--repetitions=") == 0)
+      Options::getInstance().m_repetitions = atoi(arg.c_str() + 14);
+    else if(arg.compare(0, 19, "--benchmark-output=") == 0)
+      Options::getInstance().m_benchmark_output = arg.substr(19);
+  }
   return RUN_ALL_TESTS();
 }
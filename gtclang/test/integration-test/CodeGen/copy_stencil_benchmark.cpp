@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 #include "test/integration-test/CodeGen/Macros.hpp"
+#include "test/integration-test/CodeGen/Benchmark.hpp"
 #include "driver-includes/verify.hpp"
 #include "test/integration-test/CodeGen/Options.hpp"
 #include "test/integration-test/CodeGen/generated/copy_stencil_c++-naive.cpp"
@@ -60,3 +61,29 @@ TEST(copy_stencil, test) {
 
   ASSERT_TRUE(verif.verify(out_gt, out_naive));
 }
+
+TEST(copy_stencil, benchmark) {
+  if(!Options::getInstance().m_benchmark)
+    GTEST_SKIP() << "benchmarks only run with --benchmark";
+
+  for(const auto& size : benchmark_sizes()) {
+    domain dom(size);
+    dom.set_halos(halo::value, halo::value, halo::value, halo::value, 0, 0);
+
+    verifier verif(dom);
+
+    meta_data_t meta_data(dom.isize(), dom.jsize(), dom.ksize() + 1);
+    storage_t in(meta_data, "in"), out(meta_data, "out");
+
+    verif.fillMath(8.0, 2.0, 1.5, 1.5, 2.0, 4.0, in);
+    verif.fill(-1.0, out);
+
+    dawn_generated::OPTBACKEND::copy_stencil copy_gt(dom);
+    dawn_generated::cxxnaive::copy_stencil copy_naive(dom);
+
+    // out = in
+    const stencil_cost cost{2, 0};
+    benchmark("copy_stencil", STRINGIFY(OPTBACKEND), dom, cost, [&] { copy_gt.run(in, out); });
+    benchmark("copy_stencil", "cxxnaive", dom, cost, [&] { copy_naive.run(in, out); });
+  }
+}
@@ -27,6 +27,7 @@
 
 #include "driver-includes/verify.hpp"
 #include "test/integration-test/CodeGen/Macros.hpp"
+#include "test/integration-test/CodeGen/Benchmark.hpp"
 #include "test/integration-test/CodeGen/Options.hpp"
 #include "test/integration-test/CodeGen/generated/hd_smagorinsky_c++-naive.cpp"
 #include <gtest/gtest.h>
@@ -97,3 +98,52 @@ TEST(hd_smagorinsky, test) {
   ASSERT_TRUE(verif.verify(u_out_gt, u_out_naive));
   ASSERT_TRUE(verif.verify(v_out_gt, v_out_naive));
 }
+
+TEST(hd_smagorinsky, benchmark) {
+  if(!Options::getInstance().m_benchmark)
+    GTEST_SKIP() << "benchmarks only run with --benchmark";
+
+  for(const auto& size : benchmark_sizes()) {
+    domain dom(size);
+    dom.set_halos(halo::value, halo::value, halo::value, halo::value, 0, 0);
+
+    verifier verif(dom);
+
+    meta_data_t meta_data(dom.isize(), dom.jsize(), dom.ksize() + 1);
+    meta_data_j_t meta_data_j(1, dom.jsize(), 1);
+
+    storage_t u_out(meta_data, "u_out"), v_out(meta_data, "v_out");
+    storage_t u_in(meta_data, "u_in"), v_in(meta_data, "v_in"), hdmaskvel(meta_data, "hdmaskvel");
+    storage_j_t crlavo(meta_data_j, "crlavo"), crlavu(meta_data_j, "crlavu"),
+        crlato(meta_data_j, "crlato"), crlatu(meta_data_j, "crlatu"),
+        acrlat0(meta_data_j, "acrlat0");
+    storage_t eddlon(meta_data, "eddlon"), eddlat(meta_data, "eddlat"),
+        tau_smag(meta_data, "tau_smag"), weight_smag(meta_data, "weight_smag");
+
+    verif.fillMath(8.0, 2.0, 1.5, 1.5, 2.0, 4.0, u_in);
+    verif.fillMath(6.0, 1.0, 0.9, 1.1, 2.0, 4.0, v_in);
+    verif.fillMath(5.0, 2.2, 1.7, 1.9, 2.0, 4.0, hdmaskvel);
+    verif.fillMath(6.5, 1.2, 1.7, 1.9, 2.1, 2.0, crlavo);
+    verif.fillMath(5.0, 2.2, 1.7, 1.9, 2.0, 1.0, crlavu);
+    verif.fillMath(6.5, 1.2, 1.7, 0.9, 2.1, 2.0, crlato);
+    verif.fillMath(5.0, 2.2, 1.7, 0.9, 2.0, 1.0, crlatu);
+    verif.fillMath(6.5, 1.2, 1.2, 1.2, 2.2, 2.2, acrlat0);
+    verif.fill(0.5, eddlon, eddlat, tau_smag, weight_smag);
+    verif.fill(-1.0, u_out, v_out);
+
+    dawn_generated::OPTBACKEND::hd_smagorinsky_stencil hd_smagorinsky_gt(dom);
+    dawn_generated::cxxnaive::hd_smagorinsky_stencil hd_smagorinsky_naive(dom);
+
+    // 2 writes and 7 reads of 3D fields (the j-fields are negligible), 57 flops of which 4 are
+    // min/max and 2 are sqrt
+    const stencil_cost cost{9, 57};
+    benchmark("hd_smagorinsky", STRINGIFY(OPTBACKEND), dom, cost, [&] {
+      hd_smagorinsky_gt.run(u_out, v_out, u_in, v_in, hdmaskvel, crlavo, crlavu, crlato, crlatu,
+                            acrlat0, eddlon, eddlat, tau_smag, weight_smag);
+    });
+    benchmark("hd_smagorinsky", "cxxnaive", dom, cost, [&] {
+      hd_smagorinsky_naive.run(u_out, v_out, u_in, v_in, hdmaskvel, crlavo, crlavu, crlato,
+                               crlatu, acrlat0, eddlon, eddlat, tau_smag, weight_smag);
+    });
+  }
+}